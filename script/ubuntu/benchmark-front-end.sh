@@ -0,0 +1,42 @@
+#! /bin/bash
+
+# Measures the throughput of the whole front-end (in MB/s, and lines/s) over
+# a large generated program, mostly made of comments, whitespaces and short
+# definitions. The time covers the complete run of the compiler: the lexical
+# and syntactic analyses, but also the interning of every identifier, the
+# semantic analysis (which inserts each variable into the symbol table), and
+# the execution (which has nothing to do, since there are no statements).
+#
+# Usage: benchmark-front-end.sh [LINES] [COMPILER]
+#
+# Run it against an older build of the compiler to compare the gain.
+
+set -euo pipefail
+
+BASE_PATH="$(dirname "$0")/../.."
+cd "$BASE_PATH"
+
+LINES="${1:-200000}"
+COMPILER="${2:-build/Compiler}"
+INPUT="$(mktemp)"
+trap 'rm --force "$INPUT"' EXIT
+
+# Every line defines 2 new variables, and ends with a comment.
+awk -v lines="$LINES" 'BEGIN {
+	for (k = 0; k < lines; ++k) {
+		printf "define variable v%d, w%d; /* front-end benchmark line %d */\n", k, k, k
+	}
+}' > "$INPUT"
+
+BYTES="$(stat --format=%s "$INPUT")"
+
+START="$(date +%s%N)"
+LOGGING_LEVEL=ERROR LOG_IGNORED_LEXEMES=false "$COMPILER" < "$INPUT" > /dev/null
+END="$(date +%s%N)"
+
+awk -v bytes="$BYTES" -v lines="$LINES" -v nanoseconds="$((END - START))" 'BEGIN {
+	seconds = nanoseconds / 1e9
+	printf "Input:      %d lines, %.2f MB, %d variables\n", lines, bytes / 1e6, 2 * lines
+	printf "Time:       %.3f s\n", seconds
+	printf "Throughput: %.2f MB/s, %.0f lines/s\n", bytes / 1e6 / seconds, lines / seconds
+}'
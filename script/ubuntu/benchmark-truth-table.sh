@@ -0,0 +1,58 @@
+#! /bin/bash
+
+# Measures the throughput of the truth-table engine (in valuations/s) with
+# every available kernel, classifying a generated tautology, so every
+# valuation must be visited. The formula mixes the built-in connectives with
+# a custom operator, over the specified amount of variables. The engine is
+# forced to "truth-table", because the automatic one would classify the
+# formulas with many variables with the SAT solver instead.
+#
+# Usage: benchmark-truth-table.sh [VARIABLES] [COMPILER]
+
+set -euo pipefail
+
+BASE_PATH="$(dirname "$0")/../.."
+cd "$BASE_PATH"
+
+VARIABLES="${1:-25}"
+COMPILER="${2:-build/Compiler}"
+INPUT="$(mktemp)"
+trap 'rm --force "$INPUT"' EXIT
+
+awk -v variables="$VARIABLES" 'BEGIN {
+	printf "define variable x0"
+	for (k = 1; k < variables; ++k) {
+		printf ", x%d", k
+	}
+	printf ";\n\n"
+	printf "define operator XOR(a, b) = {\n    (true, false) -> true;\n    (false, true) -> true;\n    false otherwise;\n};\n\n"
+	formula = "x0"
+	for (k = 1; k < variables; ++k) {
+		if (k % 4 == 1) formula = "(" formula " & x" k ")"
+		else if (k % 4 == 2) formula = "(" formula " | !x" k ")"
+		else if (k % 4 == 3) formula = "(" formula " <=> XOR(x" k ", x" k - 1 "))"
+		else formula = "(" formula " => x" k ")"
+	}
+	printf "define formula f = %s;\n", formula
+	printf "define formula tautology = (${f} | !${f});\n\n"
+	printf "classify(tautology);\n"
+}' > "$INPUT"
+
+VALUATIONS="$(awk -v variables="$VARIABLES" 'BEGIN { printf "%.0f", 2 ^ variables }')"
+echo "Input:      $VARIABLES variables, $VALUATIONS valuations"
+
+# The compiler falls back to the scalar kernel (and warns about it) when the
+# CPU lacks the requested one, so the warnings must be logged.
+for KERNEL in scalar sse avx2 avx512; do
+	START="$(date +%s%N)"
+	OUTPUT="$(LOGGING_LEVEL=WARNING FORMULA_ENGINE=truth-table TRUTH_TABLE_KERNEL="$KERNEL" "$COMPILER" < "$INPUT" 2>&1)"
+	END="$(date +%s%N)"
+	if echo "$OUTPUT" | grep --quiet "unsupported"; then
+		echo "Kernel:     $KERNEL (unsupported by this CPU)"
+		continue
+	fi
+	awk -v kernel="$KERNEL" -v valuations="$VALUATIONS" -v nanoseconds="$((END - START))" 'BEGIN {
+		seconds = nanoseconds / 1e9
+		printf "Kernel:     %-7s %.3f s, %.0f valuations/s\n", kernel, seconds, valuations / seconds
+	}'
+done
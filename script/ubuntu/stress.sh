@@ -0,0 +1,106 @@
+#! /bin/bash
+
+# Runs the compiler over huge generated programs of growing sizes, with a
+# small native stack, to show that linear-sized inputs take linear time and
+# constant native stack (every traversal of the AST and of the DAG keeps its
+# pending nodes in heap-memory, and the stack of the parser grows on demand).
+#
+# The shapes are: many statements, a long chain of negations, expressions
+# nested to the left and to the right, a long chain of references, and many
+# applications of a custom operator. Each one runs with N, 2N and 4N
+# elements, so the time should double each time.
+#
+# Usage: stress.sh [N] [STACK_KB] [COMPILER]
+#
+# With STREAMING=true in the environment, the same shapes run through the
+# statement-at-a-time execution, where the applications (like every node of
+# an expression) are released along with their statement, so only the
+# definitions stay in memory.
+
+set -euo pipefail
+
+BASE_PATH="$(dirname "$0")/../.."
+cd "$BASE_PATH"
+
+SIZE="${1:-50000}"
+STACK_KB="${2:-256}"
+COMPILER="${3:-build/Compiler}"
+INPUT="$(mktemp)"
+trap 'rm --force "$INPUT"' EXIT
+
+generate() {
+	local shape="$1"
+	local size="$2"
+	awk -v shape="$shape" -v size="$size" 'BEGIN {
+		print "define variable p, q;"
+		if (shape == "statements") {
+			for (k = 0; k < size; ++k) {
+				printf "define formula f%d = ((p & q) => !q);\n", k
+				printf "complexity(f%d);\n", k
+			}
+		}
+		else if (shape == "negations") {
+			printf "define formula deep = "
+			for (k = 0; k < size; ++k) {
+				printf "!"
+			}
+			print "(p & q);"
+		}
+		else if (shape == "left-nested") {
+			printf "define formula deep = "
+			for (k = 0; k < size; ++k) {
+				printf "("
+			}
+			printf "p"
+			for (k = 0; k < size; ++k) {
+				printf " %s q)", k % 2 == 0 ? "&" : "|"
+			}
+			print ";"
+		}
+		else if (shape == "right-nested") {
+			printf "define formula deep = "
+			for (k = 0; k < size; ++k) {
+				printf "(%s %s ", k % 2 == 0 ? "p" : "q", k % 2 == 0 ? "=>" : "&"
+			}
+			printf "p"
+			for (k = 0; k < size; ++k) {
+				printf ")"
+			}
+			print ";"
+		}
+		else if (shape == "applications") {
+			print "define operator OP(a, b) = { (true, true) -> true; false otherwise; };"
+			for (k = 0; k < size; ++k) {
+				printf "define formula f%d = (OP(p, q) | OP(q, p));\n", k
+				printf "classify(f%d);\n", k
+			}
+		}
+		else if (shape == "references") {
+			print "define formula f0 = (p & q);"
+			for (k = 1; k < size; ++k) {
+				printf "define formula f%d = (${f%d} %s %s);\n", k, k - 1, k % 2 == 0 ? "|" : "&", k % 3 == 0 ? "!q" : "p"
+			}
+			printf "define formula deep = ${f%d};\n", size - 1
+		}
+		if (shape != "statements" && shape != "applications") {
+			print "complexity(deep);"
+			print "classify(deep);"
+		}
+	}' > "$INPUT"
+}
+
+printf "%-14s %10s %10s %12s\n" "Shape" "Size" "Time (s)" "Status"
+for shape in statements negations left-nested right-nested references applications; do
+	for factor in 1 2 4; do
+		size=$((factor * SIZE))
+		generate "$shape" "$size"
+		START="$(date +%s%N)"
+		set +e
+		(ulimit -s "$STACK_KB" && LOGGING_LEVEL=ERROR "$COMPILER" < "$INPUT" > /dev/null 2>&1)
+		STATUS="$?"
+		set -e
+		END="$(date +%s%N)"
+		printf "%-14s %10d %10.3f %12s\n" "$shape" "$size" "$(awk -v ns="$((END - START))" 'BEGIN { print ns / 1e9 }')" \
+			"$([ "$STATUS" == "0" ] && echo "ok" || echo "failed ($STATUS)")"
+	done
+done
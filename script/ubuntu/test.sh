@@ -10,11 +10,15 @@ RED='\033[0;31m'
 OFF='\033[0m'
 STATUS=0
 
+# A test that takes longer than this (in seconds) fails, so a slow analysis
+# can't hang the suite.
+TIMEOUT=60
+
 echo "Compiler should accept..."
 echo ""
 
 for test in $(ls src/test/c/accept/); do
-	cat "src/test/c/accept/$test" | build/Compiler >/dev/null 2>&1
+	cat "src/test/c/accept/$test" | timeout $TIMEOUT build/Compiler >/dev/null 2>&1
 	RESULT="$?"
 	if [ "$RESULT" == "0" ]; then
 		echo -e "    $test, ${GREEN}and it does${OFF} (status $RESULT)"
@@ -40,5 +44,42 @@ for test in $(ls src/test/c/reject/); do
 done
 echo ""
 
+echo "Compiler should output..."
+echo ""
+
+# Each test runs in an empty directory (with an empty "files" directory for
+# the CNF_DIRECTORY and MODELS_DIRECTORY variables), under the variables of
+# its "environment" file, and must write exactly its "expected.txt" and the
+# content of its "files" directory (if any).
+COMPILER="$(pwd)/build/Compiler"
+for test in $(ls src/test/c/output/); do
+	TEST_PATH="$(pwd)/src/test/c/output/$test"
+	WORK_PATH="$(mktemp -d)"
+	mkdir "$WORK_PATH/files"
+	(cd "$WORK_PATH" && env $(cat "$TEST_PATH/environment") LOGGING_LEVEL=ERROR \
+		timeout $TIMEOUT "$COMPILER" < "$TEST_PATH/input.txt" > output.txt 2>/dev/null)
+	RESULT="$?"
+	if [ -d "$TEST_PATH/files" ]; then
+		EXPECTED_FILES_PATH="$TEST_PATH/files"
+	else
+		EXPECTED_FILES_PATH="$WORK_PATH/none"
+		mkdir "$EXPECTED_FILES_PATH"
+	fi
+	if [ "$RESULT" != "0" ]; then
+		STATUS=1
+		echo -e "    $test, ${RED}but it rejects${OFF} (status $RESULT)"
+	elif ! diff -q "$TEST_PATH/expected.txt" "$WORK_PATH/output.txt" >/dev/null; then
+		STATUS=1
+		echo -e "    $test, ${RED}but the output differs${OFF}"
+	elif ! diff -r -q "$EXPECTED_FILES_PATH" "$WORK_PATH/files" >/dev/null; then
+		STATUS=1
+		echo -e "    $test, ${RED}but the files differ${OFF}"
+	else
+		echo -e "    $test, ${GREEN}and it does${OFF}"
+	fi
+	rm -rf "$WORK_PATH"
+done
+echo ""
+
 echo "All done."
 exit $STATUS
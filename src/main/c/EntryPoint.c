@@ -1,13 +1,30 @@
-//#include "backend/code-generation/Generator.h"
-//#include "backend/domain-specific/Calculator.h"
+#include "backend/code-generation/DimacsWriter.h"
+#include "backend/code-generation/Generator.h"
+#include "backend/code-generation/ModelWriter.h"
+#include "backend/domain-specific/AdequacyChecker.h"
+#include "backend/domain-specific/BddManager.h"
+#include "backend/domain-specific/BddSession.h"
+#include "backend/domain-specific/CnfEncoder.h"
+#include "backend/domain-specific/CubeMinimizer.h"
+#include "backend/domain-specific/FormulaDag.h"
+#include "backend/domain-specific/Interpreter.h"
+#include "backend/domain-specific/ModelCounter.h"
+#include "backend/domain-specific/SatSession.h"
+#include "backend/domain-specific/SatSolver.h"
+#include "backend/domain-specific/TruthTableEngine.h"
+#include "backend/domain-specific/TruthTableKernel.h"
 #include "frontend/lexical-analysis/FlexActions.h"
+#include "frontend/semantic-analysis/SemanticAnalyzer.h"
 #include "frontend/syntactic-analysis/AbstractSyntaxTree.h"
 #include "frontend/syntactic-analysis/BisonActions.h"
 #include "frontend/syntactic-analysis/SyntacticAnalyzer.h"
+#include "shared/Arena.h"
 #include "shared/CompilerState.h"
 #include "shared/Environment.h"
+#include "shared/Identifier.h"
 #include "shared/Logger.h"
 #include "shared/String.h"
+#include "shared/SymbolTable.h"
 
 /**
  * The main entry-point of the entire application. If you use "strtok" to
@@ -16,58 +33,119 @@
  */
 const int main(const int count, const char ** arguments) {
 	Logger * logger = createLogger("EntryPoint");
+	initializeIdentifierModule();
 	initializeFlexActionsModule();
 	initializeBisonActionsModule();
 	initializeSyntacticAnalyzerModule();
 	initializeAbstractSyntaxTreeModule();
-	/* initializeCalculatorModule();
-	initializeGeneratorModule(); */
+	initializeSemanticAnalyzerModule();
+	initializeCubeMinimizerModule();
+	initializeFormulaDagModule();
+	initializeAdequacyCheckerModule();
+	initializeTruthTableKernelModule();
+	initializeSatSolverModule();
+	initializeCnfEncoderModule();
+	initializeSatSessionModule();
+	initializeBddManagerModule();
+	initializeBddSessionModule();
+	initializeModelCounterModule();
+	initializeTruthTableEngineModule();
+	initializeInterpreterModule();
+	initializeDimacsWriterModule();
+	initializeModelWriterModule();
+	initializeGeneratorModule();
 
 	// Logs the arguments of the application.
 	for (int k = 0; k < count; ++k) {
 		logDebugging(logger, "Argument %d: \"%s\"", k, arguments[k]);
 	}
 
-	// Begin compilation process.
+	// Begin compilation process. In streaming mode, each statement is
+	// analyzed and executed as soon as it's parsed, so the backend starts
+	// before the parser.
+	const boolean streaming = getBooleanOrDefault("STREAMING", false);
 	CompilerState compilerState = {
 		.abstractSyntaxtTree = NULL,
+		.arena = createArena(DEFAULT_ARENA_BLOCK_SIZE),
+		.expressionArena = createArena(DEFAULT_ARENA_BLOCK_SIZE),
+		.statementArena = createArena(DEFAULT_ARENA_BLOCK_SIZE),
+		.statementHandler = NULL,
+		.statementContext = NULL,
 		.succeed = false,
-		.value = 0
+		.symbolTable = createSymbolTable()
 	};
-	const SyntacticAnalysisStatus syntacticAnalysisStatus = parse(&compilerState);
 	CompilationStatus compilationStatus = SUCCEED;
-	if (syntacticAnalysisStatus == ACCEPT) {
+	if (streaming) {
 		// ----------------------------------------------------------------------------------------
-		// Beginning of the Backend... ------------------------------------------------------------
-		/* logDebugging(logger, "Computing expression value...");
-		Program * program = compilerState.abstractSyntaxtTree;
-		ComputationResult computationResult = computeExpression(program->expression);
-		if (computationResult.succeed) {
-			compilerState.value = computationResult.value;
-			generate(&compilerState);
+		// Beginning of the Backend (fed by the parser)... ----------------------------------------
+		generatePrologue();
+		beginStreamingExecution(&compilerState);
+		const SyntacticAnalysisStatus syntacticAnalysisStatus = parse(&compilerState);
+		if (endStreamingExecution(&compilerState) != INTERPRETATION_SUCCEED) {
+			logError(logger, "The streaming execution rejects the input program.");
+			compilationStatus = FAILED;
 		}
-		else {
-			logError(logger, "The computation phase rejects the input program.");
+		if (syntacticAnalysisStatus != ACCEPT) {
+			logError(logger, "The syntactic-analysis phase rejects the input program.");
 			compilationStatus = FAILED;
 		}
+		generateEpilogue();
 		// ...end of the Backend. -----------------------------------------------------------------
 		// ----------------------------------------------------------------------------------------
-		logDebugging(logger, "Releasing AST resources...");
-		releaseProgram(program); */
-		logDebugging(logger, "PARSING SUCCESSFUL !!!");
 	}
 	else {
-		logError(logger, "The syntactic-analysis phase rejects the input program.");
-		compilationStatus = FAILED;
+		const SyntacticAnalysisStatus syntacticAnalysisStatus = parse(&compilerState);
+		if (syntacticAnalysisStatus != ACCEPT) {
+			logError(logger, "The syntactic-analysis phase rejects the input program.");
+			compilationStatus = FAILED;
+		}
+		else if (analyzeSemantics(&compilerState) != SEMANTIC_ACCEPT) {
+			logError(logger, "The semantic-analysis phase rejects the input program.");
+			compilationStatus = FAILED;
+		}
+		else {
+			// ------------------------------------------------------------------------------------
+			// Beginning of the Backend... --------------------------------------------------------
+			generatePrologue();
+			if (interpret(&compilerState) != INTERPRETATION_SUCCEED) {
+				logError(logger, "The execution phase rejects the input program.");
+				compilationStatus = FAILED;
+			}
+			generateEpilogue();
+			// ...end of the Backend. -------------------------------------------------------------
+			// ------------------------------------------------------------------------------------
+		}
 	}
 
+	logDebugging(logger, "Releasing AST resources (%zu bytes in %zu blocks)...",
+		compilerState.arena->allocatedBytes, compilerState.arena->blocks);
+	destroyArena(compilerState.arena);
+	destroyArena(compilerState.expressionArena);
+	destroyArena(compilerState.statementArena);
+	destroySymbolTable(compilerState.symbolTable);
+
 	logDebugging(logger, "Releasing modules resources...");
-	/* shutdownGeneratorModule();
-	shutdownCalculatorModule(); */
+	shutdownGeneratorModule();
+	shutdownModelWriterModule();
+	shutdownDimacsWriterModule();
+	shutdownInterpreterModule();
+	shutdownTruthTableEngineModule();
+	shutdownModelCounterModule();
+	shutdownBddSessionModule();
+	shutdownBddManagerModule();
+	shutdownSatSessionModule();
+	shutdownCnfEncoderModule();
+	shutdownSatSolverModule();
+	shutdownTruthTableKernelModule();
+	shutdownAdequacyCheckerModule();
+	shutdownFormulaDagModule();
+	shutdownCubeMinimizerModule();
+	shutdownSemanticAnalyzerModule();
 	shutdownAbstractSyntaxTreeModule();
 	shutdownSyntacticAnalyzerModule();
 	shutdownBisonActionsModule();
 	shutdownFlexActionsModule();
+	shutdownIdentifierModule();
 	logDebugging(logger, "Compilation is done.");
 	destroyLogger(logger);
 	return compilationStatus;
@@ -0,0 +1,136 @@
+#include "DimacsWriter.h"
+
+/* MODULE INTERNAL STATE */
+
+static Logger * _logger = NULL;
+
+void initializeDimacsWriterModule() {
+	_logger = createLogger("DimacsWriter");
+}
+
+void shutdownDimacsWriterModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/**
+ * The amount of digits of the largest 64-bit integer.
+ */
+#define MAX_INTEGER_DIGITS 20
+
+struct DimacsWriter {
+	FILE * file;
+	boolean failed;
+	uint64_t bytes;
+
+	size_t length;
+	char buffer[DIMACS_BUFFER_SIZE];
+};
+
+/* PRIVATE FUNCTIONS */
+
+static void _flush(DimacsWriter * dimacsWriter);
+static void _writeCharacter(DimacsWriter * dimacsWriter, const char character);
+static void _writeInteger(DimacsWriter * dimacsWriter, const int64_t integer);
+
+/**
+ * Writes the content of the buffer to the file, and empties it.
+ */
+static void _flush(DimacsWriter * dimacsWriter) {
+	if (0 < dimacsWriter->length && !dimacsWriter->failed) {
+		if (fwrite(dimacsWriter->buffer, 1, dimacsWriter->length, dimacsWriter->file) < dimacsWriter->length) {
+			logError(_logger, "Cannot write the CNF formula (after %llu bytes).", (unsigned long long) dimacsWriter->bytes);
+			dimacsWriter->failed = true;
+		}
+	}
+	dimacsWriter->bytes += dimacsWriter->length;
+	dimacsWriter->length = 0;
+}
+
+/**
+ * Appends a character to the buffer, flushing it first if it's full.
+ */
+static void _writeCharacter(DimacsWriter * dimacsWriter, const char character) {
+	if (dimacsWriter->length == DIMACS_BUFFER_SIZE) {
+		_flush(dimacsWriter);
+	}
+	dimacsWriter->buffer[dimacsWriter->length++] = character;
+}
+
+/**
+ * Appends an integer in decimal notation. This is the hot path: "fprintf"
+ * would parse the format again for every literal of every clause.
+ */
+static void _writeInteger(DimacsWriter * dimacsWriter, const int64_t integer) {
+	uint64_t magnitude = integer < 0 ? -(uint64_t) integer : (uint64_t) integer;
+	if (integer < 0) {
+		_writeCharacter(dimacsWriter, '-');
+	}
+	char digits[MAX_INTEGER_DIGITS];
+	unsigned int count = 0;
+	do {
+		digits[count++] = '0' + (char) (magnitude % 10);
+		magnitude /= 10;
+	} while (magnitude != 0);
+	while (0 < count) {
+		_writeCharacter(dimacsWriter, digits[--count]);
+	}
+}
+
+/* PUBLIC FUNCTIONS */
+
+DimacsWriter * createDimacsWriter(FILE * file) {
+	DimacsWriter * dimacsWriter = malloc(sizeof(DimacsWriter));
+	dimacsWriter->file = file;
+	dimacsWriter->failed = false;
+	dimacsWriter->bytes = 0;
+	dimacsWriter->length = 0;
+	return dimacsWriter;
+}
+
+boolean destroyDimacsWriter(DimacsWriter * dimacsWriter) {
+	_flush(dimacsWriter);
+	if (!dimacsWriter->failed && fflush(dimacsWriter->file) != 0) {
+		logError(_logger, "Cannot flush the CNF formula.");
+		dimacsWriter->failed = true;
+	}
+	const boolean succeed = !dimacsWriter->failed;
+	logDebugging(_logger, "The CNF formula takes %llu bytes.", (unsigned long long) dimacsWriter->bytes);
+	free(dimacsWriter);
+	return succeed;
+}
+
+void writeDimacsComment(DimacsWriter * dimacsWriter, const char * const format, ...) {
+	_flush(dimacsWriter);
+	va_list arguments;
+	va_start(arguments, format);
+	if (!dimacsWriter->failed) {
+		const int length = fprintf(dimacsWriter->file, "c ") + vfprintf(dimacsWriter->file, format, arguments) + fprintf(dimacsWriter->file, "\n");
+		dimacsWriter->failed = ferror(dimacsWriter->file) != 0;
+		dimacsWriter->bytes += 0 < length ? length : 0;
+	}
+	va_end(arguments);
+}
+
+void writeDimacsProblem(DimacsWriter * dimacsWriter, const unsigned int variableCount, const uint64_t clauseCount) {
+	_writeCharacter(dimacsWriter, 'p');
+	_writeCharacter(dimacsWriter, ' ');
+	_writeCharacter(dimacsWriter, 'c');
+	_writeCharacter(dimacsWriter, 'n');
+	_writeCharacter(dimacsWriter, 'f');
+	_writeCharacter(dimacsWriter, ' ');
+	_writeInteger(dimacsWriter, variableCount);
+	_writeCharacter(dimacsWriter, ' ');
+	_writeInteger(dimacsWriter, (int64_t) clauseCount);
+	_writeCharacter(dimacsWriter, '\n');
+}
+
+void writeDimacsClause(DimacsWriter * dimacsWriter, const Literal * literals, const unsigned int count) {
+	for (unsigned int k = 0; k < count; ++k) {
+		_writeInteger(dimacsWriter, literals[k]);
+		_writeCharacter(dimacsWriter, ' ');
+	}
+	_writeInteger(dimacsWriter, 0);
+	_writeCharacter(dimacsWriter, '\n');
+}
@@ -0,0 +1,56 @@
+#ifndef DIMACS_WRITER_HEADER
+#define DIMACS_WRITER_HEADER
+
+#include "../../shared/Logger.h"
+#include "../../shared/Type.h"
+#include "../domain-specific/SatSolver.h"
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/** Initialize module's internal state. */
+void initializeDimacsWriterModule();
+
+/** Shutdown module's internal state. */
+void shutdownDimacsWriterModule();
+
+/**
+ * The size of the buffer of a writer. Nothing else grows with the size of
+ * the formula, so a writer uses the same memory for a clause than for
+ * millions of them.
+ */
+#define DIMACS_BUFFER_SIZE 65536
+
+typedef struct DimacsWriter DimacsWriter;
+
+/**
+ * Creates a writer of a CNF formula in the DIMACS format (the input format
+ * of SAT4J), over an open file. The writer doesn't own the file.
+ */
+DimacsWriter * createDimacsWriter(FILE * file);
+
+/**
+ * Flushes the buffer, and destroys the writer. Returns false if any write
+ * failed.
+ */
+boolean destroyDimacsWriter(DimacsWriter * dimacsWriter);
+
+/**
+ * Writes a comment line (i.e., "c <comment>"). The comments must precede the
+ * problem line.
+ */
+void writeDimacsComment(DimacsWriter * dimacsWriter, const char * const format, ...);
+
+/**
+ * Writes the problem line (i.e., "p cnf <variables> <clauses>"), that must
+ * precede the clauses.
+ */
+void writeDimacsProblem(DimacsWriter * dimacsWriter, const unsigned int variableCount, const uint64_t clauseCount);
+
+/**
+ * Writes a clause: its literals, and the terminating 0.
+ */
+void writeDimacsClause(DimacsWriter * dimacsWriter, const Literal * literals, const unsigned int count);
+
+#endif
@@ -18,125 +18,24 @@ void shutdownGeneratorModule() {
 
 /** PRIVATE FUNCTIONS */
 
-static const char _expressionTypeToCharacter(const ExpressionType type);
-static void _generateConstant(const unsigned int indentationLevel, Constant * constant);
-static void _generateEpilogue(const int value);
-static void _generateExpression(const unsigned int indentationLevel, Expression * expression);
-static void _generateFactor(const unsigned int indentationLevel, Factor * factor);
-static void _generateProgram(Program * program);
-static void _generatePrologue(void);
+static char * _escapeIdentifier(const Identifier * identifier);
 static char * _indentation(const unsigned int indentationLevel);
 static void _output(const unsigned int indentationLevel, const char * const format, ...);
 
 /**
- * Converts and expression type to the proper character of the operation
- * involved, or returns '\0' if that's not possible.
+ * Creates a copy of the name of an identifier (using heap-memory), that can
+ * be used inside a Latex document (i.e., escaping the underscores).
  */
-static const char _expressionTypeToCharacter(const ExpressionType type) {
-	switch (type) {
-		case ADDITION: return '+';
-		case DIVISION: return '/';
-		case MULTIPLICATION: return '*';
-		case SUBTRACTION: return '-';
-		default:
-			logError(_logger, "The specified expression type cannot be converted into character: %d", type);
-			return '\0';
+static char * _escapeIdentifier(const Identifier * identifier) {
+	char * escaped = calloc(2 * identifier->length + 1, sizeof(char));
+	char * cursor = escaped;
+	for (unsigned int k = 0; k < identifier->length; ++k) {
+		if (identifier->name[k] == '_') {
+			*cursor++ = '\\';
+		}
+		*cursor++ = identifier->name[k];
 	}
-}
-
-/**
- * Generates the output of a constant.
- */
-static void _generateConstant(const unsigned int indentationLevel, Constant * constant) {
-	_output(indentationLevel, "%s", "[ $C$, circle, draw, black!20\n");
-	_output(1 + indentationLevel, "%s%d%s", "[ $", constant->value, "$, circle, draw ]\n");
-	_output(indentationLevel, "%s", "]\n");
-}
-
-/**
- * Creates the epilogue of the generated output, that is, the final lines that
- * completes a valid Latex document.
- */
-static void _generateEpilogue(const int value) {
-	_output(0, "%s%d%s",
-		"            [ $", value, "$, circle, draw, blue ]\n"
-		"        ]\n"
-		"    \\end{forest}\n"
-		"\\end{document}\n\n"
-	);
-}
-
-/**
- * Generates the output of an expression.
- */
-static void _generateExpression(const unsigned int indentationLevel, Expression * expression) {
-	_output(indentationLevel, "%s", "[ $E$, circle, draw, black!20\n");
-	switch (expression->type) {
-		case ADDITION:
-		case DIVISION:
-		case MULTIPLICATION:
-		case SUBTRACTION:
-			_generateExpression(1 + indentationLevel, expression->leftExpression);
-			_output(1 + indentationLevel, "%s%c%s", "[ $", _expressionTypeToCharacter(expression->type), "$, circle, draw, purple ]\n");
-			_generateExpression(1 + indentationLevel, expression->rightExpression);
-			break;
-		case FACTOR:
-			_generateFactor(1 + indentationLevel, expression->factor);
-			break;
-		default:
-			logError(_logger, "The specified expression type is unknown: %d", expression->type);
-			break;
-	}
-	_output(indentationLevel, "%s", "]\n");
-}
-
-/**
- * Generates the output of a factor.
- */
-static void _generateFactor(const unsigned int indentationLevel, Factor * factor) {
-	_output(indentationLevel, "%s", "[ $F$, circle, draw, black!20\n");
-	switch (factor->type) {
-		case CONSTANT:
-			_generateConstant(1 + indentationLevel, factor->constant);
-			break;
-		case EXPRESSION:
-			_output(1 + indentationLevel, "%s", "[ $($, circle, draw, purple ]\n");
-			_generateExpression(1 + indentationLevel, factor->expression);
-			_output(1 + indentationLevel, "%s", "[ $)$, circle, draw, purple ]\n");
-			break;
-		default:
-			logError(_logger, "The specified factor type is unknown: %d", factor->type);
-			break;
-	}
-	_output(indentationLevel, "%s", "]\n");
-}
-
-/**
- * Generates the output of the program.
- */
-static void _generateProgram(Program * program) {
-	_generateExpression(3, program->expression);
-}
-
-/**
- * Creates the prologue of the generated output, a Latex document that renders
- * a tree thanks to the Forest package.
- *
- * @see https://ctan.dcc.uchile.cl/graphics/pgf/contrib/forest/forest-doc.pdf
- */
-static void _generatePrologue(void) {
-	_output(0, "%s",
-		"\\documentclass{standalone}\n\n"
-		"\\usepackage[utf8]{inputenc}\n"
-		"\\usepackage[T1]{fontenc}\n"
-		"\\usepackage{amsmath}\n"
-		"\\usepackage{forest}\n"
-		"\\usepackage{microtype}\n\n"
-		"\\begin{document}\n"
-		"    \\centering\n"
-		"    \\begin{forest}\n"
-		"        [ \\text{$=$}, circle, draw, purple\n"
-	);
+	return escaped;
 }
 
 /**
@@ -165,10 +64,145 @@ static void _output(const unsigned int indentationLevel, const char * const form
 
 /** PUBLIC FUNCTIONS */
 
-void generate(CompilerState * compilerState) {
+void generatePrologue(void) {
 	logDebugging(_logger, "Generating final output...");
-	_generatePrologue();
-	_generateProgram(compilerState->abstractSyntaxtTree);
-	_generateEpilogue(compilerState->value);
+	_output(0, "%s",
+		"\\documentclass{article}\n\n"
+		"\\usepackage[utf8]{inputenc}\n"
+		"\\usepackage[T1]{fontenc}\n"
+		"\\usepackage{amsmath}\n"
+		"\\usepackage{longtable}\n"
+		"\\usepackage{microtype}\n\n"
+		"\\begin{document}\n"
+	);
+}
+
+void generateEpilogue(void) {
+	_output(0, "%s", "\\end{document}\n\n");
 	logDebugging(_logger, "Generation is done.");
 }
+
+void generateEvaluation(const Identifier * formulaName, const Identifier * valuationName, const boolean value) {
+	char * formula = _escapeIdentifier(formulaName);
+	char * valuation = _escapeIdentifier(valuationName);
+	_output(1, "\\paragraph{evaluate(\\texttt{%s}, \\texttt{%s})} %s\n\n", formula, valuation, value ? "true" : "false");
+	free(valuation);
+	free(formula);
+}
+
+void generateAdequacy(const Identifier * opsetName, const unsigned int commonClasses) {
+	char * opset = _escapeIdentifier(opsetName);
+	_output(1, "\\paragraph{adequate(\\texttt{%s})} %s", opset, commonClasses == 0 ? "true" : "false");
+	free(opset);
+	const char * separator = ", every operator ";
+	for (unsigned int k = 0; k < POST_CLASS_COUNT; ++k) {
+		if ((commonClasses >> k) & 1) {
+			_output(0, "%s%s", separator, postClassName(1u << k));
+			const unsigned int rest = commonClasses >> (k + 1);
+			separator = (rest & (rest - 1)) == 0 ? " and " : ", ";
+		}
+	}
+	_output(0, "%s", "\n\n");
+}
+
+void generateClassification(const Identifier * formulaName, const FormulaClass formulaClass) {
+	char * formula = _escapeIdentifier(formulaName);
+	_output(1, "\\paragraph{classify(\\texttt{%s})} %s\n\n", formula, formulaClassName(formulaClass));
+	free(formula);
+}
+
+void generateCongruence(const Identifier * leftFormulaName, const Identifier * rightFormulaName, const boolean congruent,
+		const Identifier ** variables, const boolean * values, const unsigned int count) {
+	char * left = _escapeIdentifier(leftFormulaName);
+	char * right = _escapeIdentifier(rightFormulaName);
+	_output(1, "\\paragraph{congruent(\\texttt{%s}, \\texttt{%s})} %s", left, right, congruent ? "true" : "false");
+	free(right);
+	free(left);
+	for (unsigned int k = 0; k < count; ++k) {
+		char * variable = _escapeIdentifier(variables[k]);
+		_output(0, "%s\\texttt{%s} = %s", k == 0 ? ", they differ when " : ", ", variable, values[k] ? "true" : "false");
+		free(variable);
+	}
+	_output(0, "%s", "\n\n");
+}
+
+void generateModelsHeader(const CompiledFormula * compiledFormula) {
+	char * formula = _escapeIdentifier(compiledFormula->name);
+	_output(1, "\\paragraph{models(\\texttt{%s})}\n", formula);
+	free(formula);
+	_output(1, "%s", "\\begin{longtable}{|");
+	for (unsigned int column = 0; column < compiledFormula->variableCount; ++column) {
+		_output(0, "%s", "c|");
+	}
+	_output(0, "%s", "}\n");
+	_output(2, "%s", "\\hline\n");
+	_output(2, "%s", "");
+	for (unsigned int column = 0; column < compiledFormula->variableCount; ++column) {
+		char * variable = _escapeIdentifier(compiledFormula->variables[column]);
+		_output(0, "%s\\texttt{%s}", column == 0 ? "" : " & ", variable);
+		free(variable);
+	}
+	_output(0, "%s", " \\\\ \\hline\n");
+	_output(2, "%s", "\\endhead\n");
+}
+
+void generateModel(const CompiledFormula * compiledFormula, const uint64_t valuation) {
+	_output(2, "%s", "");
+	for (unsigned int column = 0; column < compiledFormula->variableCount; ++column) {
+		_output(0, "%s%c", column == 0 ? "" : " & ", modelValue(compiledFormula, valuation, column) ? 'T' : 'F');
+	}
+	_output(0, "%s", " \\\\\n");
+}
+
+void generateModelsFooter(const uint64_t models) {
+	_output(2, "%s", "\\hline\n");
+	_output(1, "%s", "\\end{longtable}\n");
+	_output(1, "%llu model%s.\n\n", (unsigned long long) models, models == 1 ? "" : "s");
+}
+
+void generateModelsFile(const CompiledFormula * compiledFormula, const uint64_t models, const char * path) {
+	char * formula = _escapeIdentifier(compiledFormula->name);
+	_output(1, "\\paragraph{models(\\texttt{%s})} %llu model%s, in \\texttt{\\detokenize{%s}}.\n\n", formula,
+		(unsigned long long) models, models == 1 ? "" : "s", path);
+	free(formula);
+}
+
+void generateCount(const Identifier * formulaName, const Natural * models) {
+	char * formula = _escapeIdentifier(formulaName);
+	char * count = naturalToString(models);
+	_output(1, "\\paragraph{count(\\texttt{%s})} %s\n\n", formula, count);
+	free(count);
+	free(formula);
+}
+
+void generateComplexity(const Identifier * formulaName, const DagAttributes * attributes) {
+	char * formula = _escapeIdentifier(formulaName);
+	char * complexity = naturalToString(attributes->complexity);
+	char * binaryComplexity = naturalToString(attributes->binaryComplexity);
+	_output(1, "\\paragraph{complexity(\\texttt{%s})} %s connective%s (%s binary), depth %u, over %u variable%s\n\n",
+		formula, complexity, strcmp(complexity, "1") == 0 ? "" : "s", binaryComplexity, attributes->depth,
+		attributes->supportSize, attributes->supportSize == 1 ? "" : "s");
+	free(binaryComplexity);
+	free(complexity);
+	free(formula);
+}
+
+void generateCnfHeader(const CompiledFormula * compiledFormula, const CnfHeader * cnfHeader, const char * path) {
+	char * formula = _escapeIdentifier(compiledFormula->name);
+	_output(1, "\\paragraph{cnf(\\texttt{%s})} %u variables and %llu clauses", formula,
+		cnfHeader->variableCount, (unsigned long long) (1 + cnfHeader->clauseCount));
+	free(formula);
+	if (path != NULL) {
+		_output(0, ", in \\texttt{\\detokenize{%s}}.\n\n", path);
+	}
+	else {
+		_output(0, "%s", ".\n");
+		_output(1, "%s", "\\begin{verbatim}\n");
+	}
+}
+
+void generateCnfFooter(const char * path) {
+	if (path == NULL) {
+		_output(1, "%s", "\\end{verbatim}\n\n");
+	}
+}
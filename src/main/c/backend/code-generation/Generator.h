@@ -3,8 +3,14 @@
 
 #include "../../frontend/syntactic-analysis/AbstractSyntaxTree.h"
 #include "../../shared/CompilerState.h"
+#include "../../shared/Identifier.h"
 #include "../../shared/Logger.h"
+#include "../../shared/Natural.h"
 #include "../../shared/String.h"
+#include "../domain-specific/AdequacyChecker.h"
+#include "../domain-specific/CnfEncoder.h"
+#include "../domain-specific/FormulaDag.h"
+#include "../domain-specific/TruthTableEngine.h"
 #include <stdarg.h>
 #include <stdio.h>
 
@@ -15,8 +21,73 @@ void initializeGeneratorModule();
 void shutdownGeneratorModule();
 
 /**
- * Generates the final output using the current compiler state.
+ * Creates the prologue of the generated output, that is, the first lines of a
+ * Latex document, that opens the list of results.
  */
-void generate(CompilerState * compilerState);
+void generatePrologue(void);
+
+/**
+ * Creates the epilogue of the generated output, that is, the final lines that
+ * completes a valid Latex document.
+ */
+void generateEpilogue(void);
+
+/**
+ * Generates the result of an "evaluate" statement.
+ */
+void generateEvaluation(const Identifier * formulaName, const Identifier * valuationName, const boolean value);
+
+/**
+ * Generates the result of an "adequate" statement, from the clones that hold
+ * every operator of the opset (it's adequate if there is none of them).
+ */
+void generateAdequacy(const Identifier * opsetName, const unsigned int commonClasses);
+
+/**
+ * Generates the result of a "classify" statement.
+ */
+void generateClassification(const Identifier * formulaName, const FormulaClass formulaClass);
+
+/**
+ * Generates the result of a "congruent" statement, with the valuation that
+ * distinguishes the formulas if they aren't congruent.
+ */
+void generateCongruence(const Identifier * leftFormulaName, const Identifier * rightFormulaName, const boolean congruent,
+	const Identifier ** variables, const boolean * values, const unsigned int count);
+
+/**
+ * Generates the result of a "models" statement: a header with a column per
+ * variable, a row per model (as they are enumerated), and a footer with the
+ * amount of models.
+ */
+void generateModelsHeader(const CompiledFormula * compiledFormula);
+void generateModel(const CompiledFormula * compiledFormula, const uint64_t valuation);
+void generateModelsFooter(const uint64_t models);
+
+/**
+ * Generates the result of a "models" statement whose models were written to
+ * a file: only the amount of models, and the path.
+ */
+void generateModelsFile(const CompiledFormula * compiledFormula, const uint64_t models, const char * path);
+
+/**
+ * Generates the result of a "count" statement: the amount of models of a
+ * formula, in decimal.
+ */
+void generateCount(const Identifier * formulaName, const Natural * models);
+
+/**
+ * Generates the result of a "complexity" statement, from the attributes of
+ * the root of a formula.
+ */
+void generateComplexity(const Identifier * formulaName, const DagAttributes * attributes);
+
+/**
+ * Generates the result of a "cnf" statement: the size of the CNF, and the
+ * file where it's written. Without a file, the DIMACS lines are written to
+ * the output between the header and the footer, in a verbatim block.
+ */
+void generateCnfHeader(const CompiledFormula * compiledFormula, const CnfHeader * cnfHeader, const char * path);
+void generateCnfFooter(const char * path);
 
 #endif
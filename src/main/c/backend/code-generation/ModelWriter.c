@@ -0,0 +1,168 @@
+#include "ModelWriter.h"
+
+/* MODULE INTERNAL STATE */
+
+static Logger * _logger = NULL;
+
+void initializeModelWriterModule() {
+	_logger = createLogger("ModelWriter");
+}
+
+void shutdownModelWriterModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+struct ModelWriter {
+	FILE * file;
+	ModelFormat modelFormat;
+	const CompiledFormula * compiledFormula;
+	boolean failed;
+	uint64_t bytes;
+	uint64_t models;
+
+	// The bytes of a model (a line, in the text format).
+	unsigned int modelSize;
+
+	size_t length;
+	unsigned char buffer[MODEL_BUFFER_SIZE];
+};
+
+/* PRIVATE FUNCTIONS */
+
+static void _flush(ModelWriter * modelWriter);
+static void _writeBytes(ModelWriter * modelWriter, const void * bytes, const size_t count);
+static void _writeInteger(ModelWriter * modelWriter, const uint64_t integer, const unsigned int size);
+
+/**
+ * Writes the content of the buffer to the file, and empties it.
+ */
+static void _flush(ModelWriter * modelWriter) {
+	if (0 < modelWriter->length && !modelWriter->failed) {
+		if (fwrite(modelWriter->buffer, 1, modelWriter->length, modelWriter->file) < modelWriter->length) {
+			logError(_logger, "Cannot write the models (after %llu bytes).", (unsigned long long) modelWriter->bytes);
+			modelWriter->failed = true;
+		}
+	}
+	modelWriter->bytes += modelWriter->length;
+	modelWriter->length = 0;
+}
+
+/**
+ * Appends some bytes to the buffer, flushing it first if they don't fit (so
+ * a model, or a line, is never split between 2 writes).
+ */
+static void _writeBytes(ModelWriter * modelWriter, const void * bytes, const size_t count) {
+	const unsigned char * cursor = bytes;
+	for (size_t written = 0; written < count;) {
+		if (modelWriter->length == MODEL_BUFFER_SIZE || (written == 0 && MODEL_BUFFER_SIZE - modelWriter->length < count)) {
+			_flush(modelWriter);
+		}
+		size_t chunk = MODEL_BUFFER_SIZE - modelWriter->length;
+		chunk = count - written < chunk ? count - written : chunk;
+		memcpy(&modelWriter->buffer[modelWriter->length], &cursor[written], chunk);
+		modelWriter->length += chunk;
+		written += chunk;
+	}
+}
+
+/**
+ * Appends an integer of the specified size, in little-endian.
+ */
+static void _writeInteger(ModelWriter * modelWriter, const uint64_t integer, const unsigned int size) {
+	unsigned char bytes[8];
+	for (unsigned int k = 0; k < size; ++k) {
+		bytes[k] = (unsigned char) (integer >> (8 * k));
+	}
+	_writeBytes(modelWriter, bytes, size);
+}
+
+/* PUBLIC FUNCTIONS */
+
+ModelWriter * createModelWriter(FILE * file, const ModelFormat modelFormat, const CompiledFormula * compiledFormula) {
+	ModelWriter * modelWriter = malloc(sizeof(ModelWriter));
+	modelWriter->file = file;
+	modelWriter->modelFormat = modelFormat;
+	modelWriter->compiledFormula = compiledFormula;
+	modelWriter->failed = false;
+	modelWriter->bytes = 0;
+	modelWriter->models = 0;
+	modelWriter->length = 0;
+	const unsigned int variableCount = compiledFormula->variableCount;
+	if (modelFormat == TEXT_MODEL_FORMAT) {
+		modelWriter->modelSize = 1 + variableCount;
+		for (unsigned int column = 0; column < variableCount; ++column) {
+			if (0 < column) {
+				_writeBytes(modelWriter, " ", 1);
+			}
+			_writeBytes(modelWriter, compiledFormula->variables[column]->name, compiledFormula->variables[column]->length);
+		}
+		_writeBytes(modelWriter, "\n", 1);
+		return modelWriter;
+	}
+	modelWriter->modelSize = variableCount <= 8 ? 1 : variableCount <= 16 ? 2 : variableCount <= 32 ? 4 : 8 * ((variableCount + 63) / 64);
+	size_t namesSize = 0;
+	for (unsigned int column = 0; column < variableCount; ++column) {
+		namesSize += 1 + compiledFormula->variables[column]->length;
+	}
+	const size_t offset = (MODEL_FILE_HEADER_SIZE + namesSize + 7) & ~(size_t) 7;
+	_writeBytes(modelWriter, MODEL_FILE_MAGIC, 8);
+	_writeInteger(modelWriter, MODEL_FILE_VERSION, 4);
+	_writeInteger(modelWriter, variableCount, 4);
+	_writeInteger(modelWriter, modelWriter->modelSize, 4);
+	_writeInteger(modelWriter, offset, 4);
+	// The amount of models is written again once it's known.
+	_writeInteger(modelWriter, UINT64_MAX, 8);
+	for (unsigned int column = 0; column < variableCount; ++column) {
+		_writeBytes(modelWriter, compiledFormula->variables[column]->name, 1 + compiledFormula->variables[column]->length);
+	}
+	_writeInteger(modelWriter, 0, offset - MODEL_FILE_HEADER_SIZE - namesSize);
+	return modelWriter;
+}
+
+boolean destroyModelWriter(ModelWriter * modelWriter) {
+	_flush(modelWriter);
+	if (modelWriter->modelFormat == BINARY_MODEL_FORMAT && !modelWriter->failed) {
+		// The amount of models goes at offset 24 of the header (the file must be
+		// seekable).
+		unsigned char bytes[8];
+		for (unsigned int k = 0; k < 8; ++k) {
+			bytes[k] = (unsigned char) (modelWriter->models >> (8 * k));
+		}
+		if (fseek(modelWriter->file, 24, SEEK_SET) != 0 || fwrite(bytes, 1, 8, modelWriter->file) < 8 || fseek(modelWriter->file, 0, SEEK_END) != 0) {
+			logError(_logger, "Cannot write the amount of models in the header.");
+			modelWriter->failed = true;
+		}
+	}
+	if (!modelWriter->failed && fflush(modelWriter->file) != 0) {
+		logError(_logger, "Cannot flush the models.");
+		modelWriter->failed = true;
+	}
+	const boolean succeed = !modelWriter->failed;
+	logDebugging(_logger, "The %llu models take %llu bytes.", (unsigned long long) modelWriter->models, (unsigned long long) modelWriter->bytes);
+	free(modelWriter);
+	return succeed;
+}
+
+void writeModel(ModelWriter * modelWriter, const uint64_t valuation) {
+	const CompiledFormula * compiledFormula = modelWriter->compiledFormula;
+	// Every model fits in 8 bytes (or in a line of up to 64 variables), since
+	// the valuations are enumerated by a 64-bit index.
+	unsigned char model[65];
+	memset(model, 0, sizeof(model));
+	for (unsigned int column = 0; column < compiledFormula->variableCount; ++column) {
+		const boolean value = modelValue(compiledFormula, valuation, column);
+		if (modelWriter->modelFormat == TEXT_MODEL_FORMAT) {
+			model[column] = value ? '1' : '0';
+		}
+		else {
+			model[column / 8] |= value << (column % 8);
+		}
+	}
+	if (modelWriter->modelFormat == TEXT_MODEL_FORMAT) {
+		model[compiledFormula->variableCount] = '\n';
+	}
+	_writeBytes(modelWriter, model, modelWriter->modelSize);
+	++modelWriter->models;
+}
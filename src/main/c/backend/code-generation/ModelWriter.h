@@ -0,0 +1,76 @@
+#ifndef MODEL_WRITER_HEADER
+#define MODEL_WRITER_HEADER
+
+#include "../../shared/Logger.h"
+#include "../../shared/Type.h"
+#include "../domain-specific/TruthTableEngine.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Initialize module's internal state. */
+void initializeModelWriterModule();
+
+/** Shutdown module's internal state. */
+void shutdownModelWriterModule();
+
+/**
+ * The size of the buffer of a writer. A writer takes the same memory for a
+ * model than for billions of them.
+ */
+#define MODEL_BUFFER_SIZE 65536
+
+/**
+ * The binary format of a file of models, where every integer is little-endian
+ * and every offset is a multiple of 8 (so the file can be mapped in memory,
+ * and read in place):
+ *
+ *	- At 0, the magic "LOGMODEL" (8 bytes).
+ *	- At 8, the version (4 bytes).
+ *	- At 12, the amount of variables (4 bytes).
+ *	- At 16, the size of a model (4 bytes): 1, 2 or 4 bytes up to 8, 16 or 32
+ *	  variables, and 8 bytes per 64 variables from then on.
+ *	- At 20, the offset of the first model (4 bytes).
+ *	- At 24, the amount of models (8 bytes).
+ *	- At 32, the names of the variables, in order, each one terminated by a
+ *	  0, and padded with 0s up to the first model.
+ *
+ * Then, the models come one after another, as bitsets: the variable "c" is
+ * the bit "c % 8" of the byte "c / 8" of the model.
+ */
+#define MODEL_FILE_MAGIC "LOGMODEL"
+#define MODEL_FILE_VERSION 1
+#define MODEL_FILE_HEADER_SIZE 32
+
+/**
+ * The formats of a file of models: the binary one, or a text one, with a
+ * line with the names of the variables, and then a line per model, with a
+ * "0" or a "1" per variable (written by chunks of whole lines).
+ */
+typedef enum {
+	BINARY_MODEL_FORMAT,
+	TEXT_MODEL_FORMAT
+} ModelFormat;
+
+typedef struct ModelWriter ModelWriter;
+
+/**
+ * Creates a writer of the models of a formula, over a file open for writing
+ * (the writer doesn't own the file), and writes the header.
+ */
+ModelWriter * createModelWriter(FILE * file, const ModelFormat modelFormat, const CompiledFormula * compiledFormula);
+
+/**
+ * Flushes the buffer (and, in the binary format, writes the amount of
+ * models in the header), and destroys the writer. Returns false if any write
+ * failed.
+ */
+boolean destroyModelWriter(ModelWriter * modelWriter);
+
+/**
+ * Writes a model, by index of valuation.
+ */
+void writeModel(ModelWriter * modelWriter, const uint64_t valuation);
+
+#endif
@@ -0,0 +1,226 @@
+#include "AdequacyChecker.h"
+
+/* MODULE INTERNAL STATE */
+
+/**
+ * The built-in connectives, and their clones.
+ */
+#define BUILT_IN_COUNT 5
+
+/**
+ * The pattern of the argument "k" (for k < 6) inside a word: the bit "v" is
+ * the bit "k" of "v".
+ */
+static const uint64_t _patterns[6] = {
+	0xAAAAAAAAAAAAAAAAull,
+	0xCCCCCCCCCCCCCCCCull,
+	0xF0F0F0F0F0F0F0F0ull,
+	0xFF00FF00FF00FF00ull,
+	0xFFFF0000FFFF0000ull,
+	0xFFFFFFFF00000000ull
+};
+
+static const Identifier * _builtInNames[BUILT_IN_COUNT];
+static unsigned int _builtInClasses[BUILT_IN_COUNT];
+static Logger * _logger = NULL;
+
+void initializeAdequacyCheckerModule() {
+	_logger = createLogger("AdequacyChecker");
+	// The tables of the connectives, where "x" is the bit 0 of the input, and
+	// "y" is the bit 1.
+	const uint64_t tables[BUILT_IN_COUNT] = {0x8, 0xE, 0x1, 0xD, 0x9};
+	const unsigned int arities[BUILT_IN_COUNT] = {2, 2, 1, 2, 2};
+	_builtInNames[0] = internIdentifier("&", 1);
+	_builtInNames[1] = internIdentifier("|", 1);
+	_builtInNames[2] = internIdentifier("!", 1);
+	_builtInNames[3] = internIdentifier("=>", 2);
+	_builtInNames[4] = internIdentifier("<=>", 3);
+	for (unsigned int k = 0; k < BUILT_IN_COUNT; ++k) {
+		_builtInClasses[k] = packedPostClasses(&tables[k], arities[k]);
+	}
+}
+
+void shutdownAdequacyCheckerModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/* PRIVATE FUNCTIONS */
+
+static boolean _isAffine(const uint64_t * table, const unsigned int arity, const uint64_t wordCount, const uint64_t mask);
+static boolean _isMonotone(const uint64_t * table, const unsigned int arity, const uint64_t wordCount, const uint64_t mask);
+static boolean _isSelfDual(const uint64_t * table, const unsigned int arity, const uint64_t wordCount, const uint64_t mask);
+static uint64_t * _packCover(const CubeCover * cubeCover, const unsigned int arity);
+static boolean _packedBit(const uint64_t * table, const uint64_t input);
+static uint64_t _reverseBits(uint64_t word);
+
+/**
+ * Returns true if the table is the one of the affine function that it should
+ * be: the constant is the image of 0, and the argument "k" is in the sum if,
+ * and only if, flipping it alone flips the image of 0.
+ */
+static boolean _isAffine(const uint64_t * table, const unsigned int arity, const uint64_t wordCount, const uint64_t mask) {
+	const boolean constant = _packedBit(table, 0);
+	uint64_t pattern = constant ? ~0ull : 0;
+	uint64_t wordSum = 0;
+	for (unsigned int k = 0; k < arity; ++k) {
+		if (_packedBit(table, 1ull << k) != constant) {
+			if (k < 6) {
+				pattern ^= _patterns[k];
+			}
+			else {
+				wordSum |= 1ull << (k - 6);
+			}
+		}
+	}
+	for (uint64_t word = 0; word < wordCount; ++word) {
+		const uint64_t expected = __builtin_parityll(word & wordSum) ? ~pattern : pattern;
+		if (((expected ^ table[word]) & mask) != 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Returns true if no argument can turn the image from true to false when it
+ * goes from false to true: the inputs where the argument is false, shifted
+ * onto the ones where it's true, must be inside the table.
+ */
+static boolean _isMonotone(const uint64_t * table, const unsigned int arity, const uint64_t wordCount, const uint64_t mask) {
+	for (unsigned int k = 0; k < arity && k < 6; ++k) {
+		for (uint64_t word = 0; word < wordCount; ++word) {
+			if ((((table[word] & ~_patterns[k]) << (1u << k)) & ~table[word] & mask) != 0) {
+				return false;
+			}
+		}
+	}
+	for (unsigned int k = 6; k < arity; ++k) {
+		const uint64_t stride = 1ull << (k - 6);
+		for (uint64_t word = 0; word < wordCount; ++word) {
+			if ((word & stride) == 0 && (table[word] & ~table[word | stride]) != 0) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+/**
+ * Returns true if negating every argument negates the image: the complement
+ * of the input "v" is the input "2^arity - 1 - v", so the table, reversed,
+ * must be its own complement.
+ */
+static boolean _isSelfDual(const uint64_t * table, const unsigned int arity, const uint64_t wordCount, const uint64_t mask) {
+	const unsigned int shift = arity < 6 ? 64 - (1u << arity) : 0;
+	for (uint64_t word = 0; word < wordCount; ++word) {
+		const uint64_t reversed = _reverseBits(table[wordCount - 1 - word]) >> shift;
+		if (((table[word] ^ reversed) & mask) != mask) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Packs the truth table of an operator without a dense table (using
+ * heap-memory), painting the cubes of its cover of true: each cube is a mask
+ * per word, from the patterns of its first 6 arguments, and empty in the
+ * words that the rest of its arguments exclude.
+ */
+static uint64_t * _packCover(const CubeCover * cubeCover, const unsigned int arity) {
+	const uint64_t wordCount = arity <= 6 ? 1 : 1ull << (arity - 6);
+	uint64_t * table = calloc(wordCount, sizeof(uint64_t));
+	for (unsigned int c = 0; c < cubeCover->count; ++c) {
+		const Cube cube = cubeCover->cubes[c];
+		uint64_t mask = ~0ull;
+		for (unsigned int k = 0; k < arity && k < 6; ++k) {
+			if ((cube.care >> k) & 1) {
+				mask &= ((cube.values >> k) & 1) ? _patterns[k] : ~_patterns[k];
+			}
+		}
+		for (uint64_t word = 0; word < wordCount; ++word) {
+			if (((word ^ (cube.values >> 6)) & (cube.care >> 6)) == 0) {
+				table[word] |= mask;
+			}
+		}
+	}
+	return table;
+}
+
+/**
+ * The image of an input, in a packed table.
+ */
+static boolean _packedBit(const uint64_t * table, const uint64_t input) {
+	return (table[input >> 6] >> (input & 63)) & 1;
+}
+
+/**
+ * Reverses the bits of a word.
+ */
+static uint64_t _reverseBits(uint64_t word) {
+	word = ((word >> 1) & 0x5555555555555555ull) | ((word & 0x5555555555555555ull) << 1);
+	word = ((word >> 2) & 0x3333333333333333ull) | ((word & 0x3333333333333333ull) << 2);
+	word = ((word >> 4) & 0x0F0F0F0F0F0F0F0Full) | ((word & 0x0F0F0F0F0F0F0F0Full) << 4);
+	return __builtin_bswap64(word);
+}
+
+/* PUBLIC FUNCTIONS */
+
+unsigned int packedPostClasses(const uint64_t * table, const unsigned int arity) {
+	const uint64_t wordCount = arity <= 6 ? 1 : 1ull << (arity - 6);
+	const uint64_t mask = arity < 6 ? (1ull << (1u << arity)) - 1 : ~0ull;
+	const uint64_t inputs = 1ull << arity;
+	unsigned int postClasses = 0;
+	if (!_packedBit(table, 0)) {
+		postClasses |= PRESERVES_FALSE_CLASS;
+	}
+	if (_packedBit(table, inputs - 1)) {
+		postClasses |= PRESERVES_TRUE_CLASS;
+	}
+	if (_isSelfDual(table, arity, wordCount, mask)) {
+		postClasses |= SELF_DUAL_CLASS;
+	}
+	if (_isMonotone(table, arity, wordCount, mask)) {
+		postClasses |= MONOTONE_CLASS;
+	}
+	if (_isAffine(table, arity, wordCount, mask)) {
+		postClasses |= AFFINE_CLASS;
+	}
+	return postClasses;
+}
+
+boolean builtInPostClasses(const Identifier * name, unsigned int * postClasses) {
+	for (unsigned int k = 0; k < BUILT_IN_COUNT; ++k) {
+		if (_builtInNames[k] == name) {
+			*postClasses = _builtInClasses[k];
+			return true;
+		}
+	}
+	return false;
+}
+
+unsigned int operatorPostClasses(const OperatorTable * operator) {
+	unsigned int postClasses = 0;
+	if (operator->bitmask != NULL) {
+		postClasses = packedPostClasses(operator->bitmask, operator->arity);
+	}
+	else {
+		uint64_t * table = _packCover(operator->trueCover, operator->arity);
+		postClasses = packedPostClasses(table, operator->arity);
+		free(table);
+	}
+	logDebugging(_logger, "The operator \"%s\" of arity %u belongs to the clones 0x%02X.", operator->name->name, operator->arity, postClasses);
+	return postClasses;
+}
+
+const char * postClassName(const PostClass postClass) {
+	switch (postClass) {
+		case PRESERVES_FALSE_CLASS: return "preserves false";
+		case PRESERVES_TRUE_CLASS: return "preserves true";
+		case SELF_DUAL_CLASS: return "is self-dual";
+		case MONOTONE_CLASS: return "is monotone";
+		default: return "is affine";
+	}
+}
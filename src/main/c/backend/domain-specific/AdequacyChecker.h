@@ -0,0 +1,61 @@
+#ifndef ADEQUACY_CHECKER_HEADER
+#define ADEQUACY_CHECKER_HEADER
+
+#include "../../shared/Identifier.h"
+#include "../../shared/Logger.h"
+#include "../../shared/Type.h"
+#include "FormulaDag.h"
+#include <stdint.h>
+#include <stdlib.h>
+
+/** Initialize module's internal state. */
+void initializeAdequacyCheckerModule();
+
+/** Shutdown module's internal state. */
+void shutdownAdequacyCheckerModule();
+
+/**
+ * The 5 maximal clones of Post, as a bitmask: the functions that preserve
+ * false, the ones that preserve true, the self-dual ones, the monotone ones,
+ * and the affine ones. By the criterion of Post, a set of operators is
+ * adequate (i.e., functionally complete) if, and only if, no clone holds
+ * every operator of the set.
+ */
+typedef enum {
+	PRESERVES_FALSE_CLASS = 1,
+	PRESERVES_TRUE_CLASS = 2,
+	SELF_DUAL_CLASS = 4,
+	MONOTONE_CLASS = 8,
+	AFFINE_CLASS = 16
+} PostClass;
+
+#define POST_CLASS_COUNT 5
+#define ALL_POST_CLASSES 31
+
+/**
+ * The clones of a truth table packed in 64-bit words: the bit "v" of the
+ * table is the image of the input where the argument "k" is the bit "k" of
+ * "v" (so a table of arity up to 6 takes a single word). Every clone is
+ * tested a word at a time.
+ */
+unsigned int packedPostClasses(const uint64_t * table, const unsigned int arity);
+
+/**
+ * The clones of a built-in connective, by name (e.g., "&"). Returns false if
+ * the name is not a built-in connective.
+ */
+boolean builtInPostClasses(const Identifier * name, unsigned int * postClasses);
+
+/**
+ * The clones of a custom operator, from its dense table (or, without it,
+ * packing its cover of true).
+ */
+unsigned int operatorPostClasses(const OperatorTable * operator);
+
+/**
+ * The property of the functions of a clone, for diagnostics (e.g., "is
+ * monotone").
+ */
+const char * postClassName(const PostClass postClass);
+
+#endif
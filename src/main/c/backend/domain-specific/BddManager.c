@@ -0,0 +1,868 @@
+#include "BddManager.h"
+
+/* MODULE INTERNAL STATE */
+
+/**
+ * The amount of entries of the computed cache: it starts small, and grows
+ * with the nodes up to the maximum (it's a power of 2).
+ */
+#define INITIAL_BDD_CACHE_SIZE (1u << 12)
+#define MAX_BDD_CACHE_SIZE (1u << 22)
+
+/**
+ * The amount of nodes alive that triggers the first collection (the next
+ * ones are triggered when the nodes alive double).
+ */
+#define INITIAL_BDD_COLLECTION_THRESHOLD (1u << 16)
+
+/**
+ * The amount of nodes alive that triggers the first reordering (the next
+ * ones are triggered when the nodes alive double).
+ */
+#define INITIAL_BDD_REORDERING_THRESHOLD (1u << 12)
+
+/**
+ * Sifting stops moving a variable in one direction once the nodes grow past
+ * this ratio of the best size found (as a fraction, 6 / 5 = 1.2).
+ */
+#define MAX_SIFTING_GROWTH_NUMERATOR 6
+#define MAX_SIFTING_GROWTH_DENOMINATOR 5
+
+/**
+ * The swaps of adjacent levels that a reordering may explore, per variable
+ * (the ones that bring a variable back to its best level are always done).
+ * The largest variables are sifted first, so if the budget runs out, the
+ * smallest ones stay where they are.
+ */
+#define MAX_SIFTING_SWAPS_PER_VARIABLE 64
+
+/**
+ * A reordering that removes less than this fraction of the nodes (as a
+ * fraction, 1 / 10) means the order is already good: the next one waits
+ * until the nodes alive quadruple, instead of doubling.
+ */
+#define MIN_SIFTING_GAIN_NUMERATOR 1
+#define MIN_SIFTING_GAIN_DENOMINATOR 10
+
+#define FREE_VARIABLE (UINT_MAX - 1)
+#define NO_NODE UINT_MAX
+
+/**
+ * The last operand of the cache entries of "bddRestrict" (minus the value of
+ * the variable), which is never an edge.
+ */
+#define RESTRICT_TAG (UINT_MAX - 1)
+
+static Logger * _logger = NULL;
+
+void initializeBddManagerModule() {
+	_logger = createLogger("BddManager");
+}
+
+void shutdownBddManagerModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/**
+ * A node of the unique table: the variable, and the edges for each value of
+ * it. The free nodes are chained through "next", as the nodes of a bucket.
+ */
+typedef struct {
+	unsigned int variable;
+	BddEdge high;
+	BddEdge low;
+	unsigned int next;
+	unsigned int references;
+} BddNode;
+
+/**
+ * An entry of the computed cache: the operands of an ITE (or of a
+ * restriction), and its result. The empty entries have NO_NODE as condition.
+ */
+typedef struct {
+	BddEdge condition;
+	BddEdge then;
+	BddEdge otherwise;
+	BddEdge result;
+} CacheEntry;
+
+/**
+ * The nodes of a variable, only while reordering. It may hold released or
+ * relabeled nodes, and repeated ones, until it's compacted.
+ */
+typedef struct {
+	unsigned int * nodes;
+	unsigned int count;
+	unsigned int capacity;
+} NodeList;
+
+/**
+ * A variable, and its amount of nodes (to sift the largest ones first).
+ */
+typedef struct {
+	unsigned int variable;
+	unsigned int nodeCount;
+} VariableWeight;
+
+/**
+ * The state of "bddModelCount": the amount of counted variables at each
+ * level or below it (by level, plus the one of the terminal node), and the
+ * models of each node, and of its negation (or NULL, until it's counted).
+ */
+typedef struct {
+	const BddManager * bddManager;
+	unsigned int * countedBelow;
+	Natural ** trues;
+	Natural ** falses;
+} ModelCounting;
+
+struct BddManager {
+	BddNode * nodes;
+	unsigned int nodeCount;
+	unsigned int nodeCapacity;
+	unsigned int aliveNodes;
+	unsigned int freeNodes;
+
+	// The heads of the chains of the unique table (a power-of-2 amount).
+	unsigned int * buckets;
+	unsigned int bucketCount;
+
+	CacheEntry * cache;
+	unsigned int cacheSize;
+
+	// The level of each variable (the level 0 is the top), and the variable
+	// of each level.
+	unsigned int * levels;
+	unsigned int * variablesByLevel;
+	unsigned int variableCount;
+	unsigned int variableCapacity;
+
+	unsigned int collectionThreshold;
+	unsigned int reorderingThreshold;
+
+	// Only while reordering: the nodes of each variable. Meanwhile, the
+	// references of every node also count its parents.
+	NodeList * nodeLists;
+
+	// Only while reordering: the last compaction that kept each node (so
+	// the repeated ones are dropped in linear time), and the swaps left.
+	unsigned int * compactions;
+	unsigned int compaction;
+	unsigned int swapBudget;
+
+	BddStatistics statistics;
+};
+
+/* PRIVATE FUNCTIONS */
+
+static void _appendNode(BddManager * bddManager, const unsigned int variable, const unsigned int node);
+static void _clearCache(BddManager * bddManager);
+static void _cofactors(const BddManager * bddManager, const BddEdge edge, const unsigned int variable, BddEdge * high, BddEdge * low);
+static int _compareWeights(const void * left, const void * right);
+static void _compactNodes(BddManager * bddManager, const unsigned int variable);
+static void _countModels(ModelCounting * modelCounting, const unsigned int node);
+static unsigned int _countNodes(const BddManager * bddManager, const BddEdge edge, unsigned char * marks);
+static uint64_t _hashTriple(const unsigned int first, const unsigned int second, const unsigned int third);
+static unsigned int _level(const BddManager * bddManager, const BddEdge edge);
+static void _linkNode(BddManager * bddManager, const unsigned int node);
+static BddEdge _makeNode(BddManager * bddManager, const unsigned int variable, BddEdge high, BddEdge low);
+static void _markNode(const BddManager * bddManager, const unsigned int node, unsigned char * marks);
+static void _rehash(BddManager * bddManager, const unsigned int bucketCount);
+static void _releaseNode(BddManager * bddManager, const unsigned int node);
+static void _siftVariable(BddManager * bddManager, const unsigned int variable);
+static void _swapLevels(BddManager * bddManager, const unsigned int level);
+static void _unlinkNode(BddManager * bddManager, const unsigned int node);
+
+/**
+ * Appends a node to the nodes of a variable (only while reordering).
+ */
+static void _appendNode(BddManager * bddManager, const unsigned int variable, const unsigned int node) {
+	NodeList * nodeList = &bddManager->nodeLists[variable];
+	if (nodeList->count == nodeList->capacity) {
+		nodeList->capacity = nodeList->capacity == 0 ? 16 : 2 * nodeList->capacity;
+		nodeList->nodes = realloc(nodeList->nodes, nodeList->capacity * sizeof(unsigned int));
+	}
+	nodeList->nodes[nodeList->count++] = node;
+}
+
+/**
+ * Empties the computed cache, growing it first if the nodes outgrew it.
+ */
+static void _clearCache(BddManager * bddManager) {
+	if (bddManager->cacheSize < MAX_BDD_CACHE_SIZE && bddManager->cacheSize < bddManager->aliveNodes) {
+		while (bddManager->cacheSize < MAX_BDD_CACHE_SIZE && bddManager->cacheSize < bddManager->aliveNodes) {
+			bddManager->cacheSize *= 2;
+		}
+		free(bddManager->cache);
+		bddManager->cache = malloc(bddManager->cacheSize * sizeof(CacheEntry));
+	}
+	memset(bddManager->cache, 0xFF, bddManager->cacheSize * sizeof(CacheEntry));
+}
+
+/**
+ * The cofactors of a function with respect to a variable that is not below
+ * its top variable (if it's above, both cofactors are the function).
+ */
+static void _cofactors(const BddManager * bddManager, const BddEdge edge, const unsigned int variable, BddEdge * high, BddEdge * low) {
+	const BddNode * node = &bddManager->nodes[edge >> 1];
+	if (node->variable != variable) {
+		*high = edge;
+		*low = edge;
+		return;
+	}
+	const BddEdge complement = edge & 1;
+	*high = node->high ^ complement;
+	*low = node->low ^ complement;
+}
+
+/**
+ * Compares 2 variables by their amount of nodes (the largest first), for
+ * "qsort".
+ */
+static int _compareWeights(const void * left, const void * right) {
+	const unsigned int leftCount = ((const VariableWeight *) left)->nodeCount;
+	const unsigned int rightCount = ((const VariableWeight *) right)->nodeCount;
+	return (leftCount < rightCount) - (leftCount > rightCount);
+}
+
+/**
+ * Removes the released, relabeled and repeated nodes from the nodes of a
+ * variable.
+ */
+static void _compactNodes(BddManager * bddManager, const unsigned int variable) {
+	NodeList * nodeList = &bddManager->nodeLists[variable];
+	const unsigned int compaction = ++bddManager->compaction;
+	unsigned int count = 0;
+	for (unsigned int k = 0; k < nodeList->count; ++k) {
+		const unsigned int node = nodeList->nodes[k];
+		if (bddManager->nodes[node].variable == variable && bddManager->compactions[node] != compaction) {
+			bddManager->compactions[node] = compaction;
+			nodeList->nodes[count++] = node;
+		}
+	}
+	nodeList->count = count;
+}
+
+/**
+ * Counts the models of a node and of its negation, over the counted variables
+ * at its level or below it. The variables skipped by an edge double the
+ * models of that edge, and a complemented edge swaps the counts of its node.
+ */
+static void _countModels(ModelCounting * modelCounting, const unsigned int node) {
+	if (modelCounting->trues[node] != NULL) {
+		return;
+	}
+	const BddManager * bddManager = modelCounting->bddManager;
+	const BddNode * bddNode = &bddManager->nodes[node];
+	const unsigned int below = modelCounting->countedBelow[bddManager->levels[bddNode->variable] + 1];
+	Natural * trues = createNatural(0);
+	Natural * falses = createNatural(0);
+	Natural * term = createNatural(0);
+	const BddEdge children[2] = {bddNode->high, bddNode->low};
+	for (unsigned int k = 0; k < 2; ++k) {
+		const unsigned int child = children[k] >> 1;
+		_countModels(modelCounting, child);
+		const unsigned int childLevel = child == 0 ? bddManager->variableCount : bddManager->levels[bddManager->nodes[child].variable];
+		const unsigned int skipped = below - modelCounting->countedBelow[childLevel];
+		const boolean complement = children[k] & 1;
+		copyNatural(term, complement ? modelCounting->falses[child] : modelCounting->trues[child]);
+		shiftNatural(term, skipped);
+		addNatural(trues, term);
+		copyNatural(term, complement ? modelCounting->trues[child] : modelCounting->falses[child]);
+		shiftNatural(term, skipped);
+		addNatural(falses, term);
+	}
+	destroyNatural(term);
+	modelCounting->trues[node] = trues;
+	modelCounting->falses[node] = falses;
+}
+
+/**
+ * Counts the nodes reachable from an edge that were not marked yet, and marks
+ * them.
+ */
+static unsigned int _countNodes(const BddManager * bddManager, const BddEdge edge, unsigned char * marks) {
+	const unsigned int index = edge >> 1;
+	if (marks[index]) {
+		return 0;
+	}
+	marks[index] = 1;
+	if (index == 0) {
+		return 1;
+	}
+	const BddNode * node = &bddManager->nodes[index];
+	return 1 + _countNodes(bddManager, node->high, marks) + _countNodes(bddManager, node->low, marks);
+}
+
+/**
+ * Hashes 3 words (FNV-1a).
+ */
+static uint64_t _hashTriple(const unsigned int first, const unsigned int second, const unsigned int third) {
+	uint64_t hash = 0xCBF29CE484222325ull;
+	hash = (hash ^ (uint64_t) first) * 0x100000001B3ull;
+	hash = (hash ^ (uint64_t) second) * 0x100000001B3ull;
+	hash = (hash ^ (uint64_t) third) * 0x100000001B3ull;
+	return hash ^ (hash >> 32);
+}
+
+/**
+ * The level of the top variable of an edge (the terminal node is below every
+ * level).
+ */
+static unsigned int _level(const BddManager * bddManager, const BddEdge edge) {
+	const unsigned int variable = bddManager->nodes[edge >> 1].variable;
+	return variable == BDD_TERMINAL_VARIABLE ? UINT_MAX : bddManager->levels[variable];
+}
+
+/**
+ * Inserts a node in its bucket of the unique table.
+ */
+static void _linkNode(BddManager * bddManager, const unsigned int node) {
+	BddNode * bddNode = &bddManager->nodes[node];
+	const unsigned int bucket = _hashTriple(bddNode->variable, bddNode->high, bddNode->low) & (bddManager->bucketCount - 1);
+	bddNode->next = bddManager->buckets[bucket];
+	bddManager->buckets[bucket] = node;
+}
+
+/**
+ * Returns the edge of the node with a variable and its cofactors, creating
+ * it the first time. The node is skipped if both cofactors are equal, and the
+ * complement of the high edge is moved to the returned edge.
+ */
+static BddEdge _makeNode(BddManager * bddManager, const unsigned int variable, BddEdge high, BddEdge low) {
+	if (high == low) {
+		return high;
+	}
+	const BddEdge complement = high & 1;
+	high ^= complement;
+	low ^= complement;
+	const unsigned int bucket = _hashTriple(variable, high, low) & (bddManager->bucketCount - 1);
+	for (unsigned int index = bddManager->buckets[bucket]; index != NO_NODE; index = bddManager->nodes[index].next) {
+		const BddNode * node = &bddManager->nodes[index];
+		if (node->variable == variable && node->high == high && node->low == low) {
+			return (index << 1) | complement;
+		}
+	}
+	unsigned int index = bddManager->freeNodes;
+	if (index != NO_NODE) {
+		bddManager->freeNodes = bddManager->nodes[index].next;
+	}
+	else {
+		if (bddManager->nodeCount == bddManager->nodeCapacity) {
+			bddManager->nodeCapacity *= 2;
+			bddManager->nodes = realloc(bddManager->nodes, bddManager->nodeCapacity * sizeof(BddNode));
+			if (bddManager->nodeLists != NULL) {
+				bddManager->compactions = realloc(bddManager->compactions, bddManager->nodeCapacity * sizeof(unsigned int));
+				memset(&bddManager->compactions[bddManager->nodeCount], 0, bddManager->nodeCount * sizeof(unsigned int));
+			}
+		}
+		index = bddManager->nodeCount++;
+	}
+	BddNode * node = &bddManager->nodes[index];
+	node->variable = variable;
+	node->high = high;
+	node->low = low;
+	node->references = 0;
+	node->next = bddManager->buckets[bucket];
+	bddManager->buckets[bucket] = index;
+	if (bddManager->nodeLists != NULL) {
+		++bddManager->nodes[high >> 1].references;
+		++bddManager->nodes[low >> 1].references;
+		_appendNode(bddManager, variable, index);
+	}
+	if (bddManager->statistics.peakNodes < ++bddManager->aliveNodes) {
+		bddManager->statistics.peakNodes = bddManager->aliveNodes;
+	}
+	if (bddManager->bucketCount < bddManager->aliveNodes) {
+		_rehash(bddManager, 2 * bddManager->bucketCount);
+	}
+	if (bddManager->cacheSize < MAX_BDD_CACHE_SIZE && bddManager->cacheSize < bddManager->aliveNodes) {
+		_clearCache(bddManager);
+	}
+	return (index << 1) | complement;
+}
+
+/**
+ * Marks a node, and every node reachable from it.
+ */
+static void _markNode(const BddManager * bddManager, const unsigned int node, unsigned char * marks) {
+	if (!marks[node]) {
+		marks[node] = 1;
+		_markNode(bddManager, bddManager->nodes[node].high >> 1, marks);
+		_markNode(bddManager, bddManager->nodes[node].low >> 1, marks);
+	}
+}
+
+/**
+ * Rebuilds the unique table with the specified amount of buckets, with the
+ * nodes alive.
+ */
+static void _rehash(BddManager * bddManager, const unsigned int bucketCount) {
+	free(bddManager->buckets);
+	bddManager->bucketCount = bucketCount;
+	bddManager->buckets = malloc(bucketCount * sizeof(unsigned int));
+	memset(bddManager->buckets, 0xFF, bucketCount * sizeof(unsigned int));
+	for (unsigned int index = 1; index < bddManager->nodeCount; ++index) {
+		BddNode * node = &bddManager->nodes[index];
+		if (node->variable != FREE_VARIABLE) {
+			const unsigned int bucket = _hashTriple(node->variable, node->high, node->low) & (bucketCount - 1);
+			node->next = bddManager->buckets[bucket];
+			bddManager->buckets[bucket] = index;
+		}
+	}
+}
+
+/**
+ * Drops a reference to a node (only while reordering), and releases it if
+ * it was the last one, together with the children left without references.
+ * The terminal node is never released.
+ */
+static void _releaseNode(BddManager * bddManager, const unsigned int node) {
+	BddNode * bddNode = &bddManager->nodes[node];
+	if (--bddNode->references == 0 && node != 0) {
+		_unlinkNode(bddManager, node);
+		const BddEdge high = bddNode->high;
+		const BddEdge low = bddNode->low;
+		bddNode->variable = FREE_VARIABLE;
+		bddNode->next = bddManager->freeNodes;
+		bddManager->freeNodes = node;
+		--bddManager->aliveNodes;
+		_releaseNode(bddManager, high >> 1);
+		_releaseNode(bddManager, low >> 1);
+	}
+}
+
+/**
+ * Moves a variable through every level, first towards the closest end, and
+ * then towards the other one, and leaves it in the level where the nodes
+ * alive were the fewest. A direction is abandoned as soon as the nodes grow
+ * too much, or the swaps of the reordering run out.
+ */
+static void _siftVariable(BddManager * bddManager, const unsigned int variable) {
+	const unsigned int last = bddManager->variableCount - 1;
+	unsigned int level = bddManager->levels[variable];
+	unsigned int bestLevel = level;
+	unsigned int bestSize = bddManager->aliveNodes;
+	const boolean downFirst = last - level < level;
+	for (unsigned int pass = 0; pass < 2; ++pass) {
+		const boolean down = pass == 0 ? downFirst : !downFirst;
+		while ((down ? level < last : 0 < level) && 0 < bddManager->swapBudget) {
+			_swapLevels(bddManager, down ? level : level - 1);
+			level = down ? level + 1 : level - 1;
+			if (bddManager->aliveNodes < bestSize) {
+				bestSize = bddManager->aliveNodes;
+				bestLevel = level;
+			}
+			else if (MAX_SIFTING_GROWTH_DENOMINATOR * (uint64_t) bddManager->aliveNodes > MAX_SIFTING_GROWTH_NUMERATOR * (uint64_t) bestSize) {
+				break;
+			}
+		}
+	}
+	while (bestLevel < level) {
+		_swapLevels(bddManager, --level);
+	}
+	while (level < bestLevel) {
+		_swapLevels(bddManager, level++);
+	}
+}
+
+/**
+ * Swaps the variables of a level and the next one, in place: the nodes of the
+ * upper variable that depend on the lower one are relabeled with the lower
+ * variable (so their edges, and the function of every node, are preserved),
+ * and the nodes of the lower variable left without parents are released.
+ */
+static void _swapLevels(BddManager * bddManager, const unsigned int level) {
+	const unsigned int upper = bddManager->variablesByLevel[level];
+	const unsigned int lower = bddManager->variablesByLevel[level + 1];
+	_compactNodes(bddManager, upper);
+	// The nodes of the upper variable that stay, and the new ones, go to a new
+	// list.
+	NodeList nodeList = bddManager->nodeLists[upper];
+	bddManager->nodeLists[upper] = (NodeList) {NULL, 0, 0};
+	for (unsigned int k = 0; k < nodeList.count; ++k) {
+		const unsigned int node = nodeList.nodes[k];
+		const BddEdge high = bddManager->nodes[node].high;
+		const BddEdge low = bddManager->nodes[node].low;
+		if (bddManager->nodes[high >> 1].variable != lower && bddManager->nodes[low >> 1].variable != lower) {
+			_appendNode(bddManager, upper, node);
+			continue;
+		}
+		BddEdge highHigh, highLow, lowHigh, lowLow;
+		_cofactors(bddManager, high, lower, &highHigh, &highLow);
+		_cofactors(bddManager, low, lower, &lowHigh, &lowLow);
+		// The high edge of the node stays regular, because "highHigh" is.
+		const BddEdge newHigh = _makeNode(bddManager, upper, highHigh, lowHigh);
+		++bddManager->nodes[newHigh >> 1].references;
+		const BddEdge newLow = _makeNode(bddManager, upper, highLow, lowLow);
+		++bddManager->nodes[newLow >> 1].references;
+		_unlinkNode(bddManager, node);
+		BddNode * bddNode = &bddManager->nodes[node];
+		bddNode->variable = lower;
+		bddNode->high = newHigh;
+		bddNode->low = newLow;
+		_linkNode(bddManager, node);
+		_appendNode(bddManager, lower, node);
+		_releaseNode(bddManager, high >> 1);
+		_releaseNode(bddManager, low >> 1);
+	}
+	free(nodeList.nodes);
+	bddManager->variablesByLevel[level] = lower;
+	bddManager->variablesByLevel[level + 1] = upper;
+	bddManager->levels[lower] = level;
+	bddManager->levels[upper] = level + 1;
+	if (0 < bddManager->swapBudget) {
+		--bddManager->swapBudget;
+	}
+	++bddManager->statistics.swaps;
+}
+
+/**
+ * Removes a node from its bucket of the unique table.
+ */
+static void _unlinkNode(BddManager * bddManager, const unsigned int node) {
+	const BddNode * bddNode = &bddManager->nodes[node];
+	unsigned int * link = &bddManager->buckets[_hashTriple(bddNode->variable, bddNode->high, bddNode->low) & (bddManager->bucketCount - 1)];
+	while (*link != node) {
+		link = &bddManager->nodes[*link].next;
+	}
+	*link = bddNode->next;
+}
+
+/* PUBLIC FUNCTIONS */
+
+BddManager * createBddManager() {
+	BddManager * bddManager = calloc(1, sizeof(BddManager));
+	bddManager->nodeCapacity = 1024;
+	bddManager->nodes = malloc(bddManager->nodeCapacity * sizeof(BddNode));
+	bddManager->nodes[0] = (BddNode) {
+		.variable = BDD_TERMINAL_VARIABLE,
+		.high = BDD_TRUE,
+		.low = BDD_TRUE,
+		.next = NO_NODE,
+		.references = 0
+	};
+	bddManager->nodeCount = 1;
+	bddManager->aliveNodes = 1;
+	bddManager->freeNodes = NO_NODE;
+	bddManager->bucketCount = 1024;
+	bddManager->buckets = malloc(bddManager->bucketCount * sizeof(unsigned int));
+	memset(bddManager->buckets, 0xFF, bddManager->bucketCount * sizeof(unsigned int));
+	bddManager->cacheSize = INITIAL_BDD_CACHE_SIZE;
+	bddManager->cache = malloc(bddManager->cacheSize * sizeof(CacheEntry));
+	memset(bddManager->cache, 0xFF, bddManager->cacheSize * sizeof(CacheEntry));
+	bddManager->collectionThreshold = INITIAL_BDD_COLLECTION_THRESHOLD;
+	bddManager->reorderingThreshold = INITIAL_BDD_REORDERING_THRESHOLD;
+	bddManager->statistics.peakNodes = 1;
+	return bddManager;
+}
+
+void destroyBddManager(BddManager * bddManager) {
+	if (bddManager != NULL) {
+		free(bddManager->nodes);
+		free(bddManager->buckets);
+		free(bddManager->cache);
+		free(bddManager->levels);
+		free(bddManager->variablesByLevel);
+		free(bddManager);
+	}
+}
+
+unsigned int newBddVariable(BddManager * bddManager) {
+	if (bddManager->variableCount == bddManager->variableCapacity) {
+		bddManager->variableCapacity = bddManager->variableCapacity == 0 ? 64 : 2 * bddManager->variableCapacity;
+		bddManager->levels = realloc(bddManager->levels, bddManager->variableCapacity * sizeof(unsigned int));
+		bddManager->variablesByLevel = realloc(bddManager->variablesByLevel, bddManager->variableCapacity * sizeof(unsigned int));
+	}
+	const unsigned int variable = bddManager->variableCount++;
+	bddManager->levels[variable] = variable;
+	bddManager->variablesByLevel[variable] = variable;
+	return variable;
+}
+
+unsigned int bddVariableCount(const BddManager * bddManager) {
+	return bddManager->variableCount;
+}
+
+BddEdge bddVariable(BddManager * bddManager, const unsigned int variable) {
+	return _makeNode(bddManager, variable, BDD_TRUE, BDD_FALSE);
+}
+
+BddEdge bddNot(const BddEdge edge) {
+	return edge ^ 1;
+}
+
+BddEdge bddIte(BddManager * bddManager, BddEdge condition, BddEdge then, BddEdge otherwise) {
+	if (condition == BDD_TRUE) {
+		return then;
+	}
+	if (condition == BDD_FALSE) {
+		return otherwise;
+	}
+	// Inside "then", the condition is true; inside "otherwise", it's false.
+	if ((then >> 1) == (condition >> 1)) {
+		then = then == condition ? BDD_TRUE : BDD_FALSE;
+	}
+	if ((otherwise >> 1) == (condition >> 1)) {
+		otherwise = otherwise == condition ? BDD_FALSE : BDD_TRUE;
+	}
+	if (then == otherwise) {
+		return then;
+	}
+	if (then == BDD_TRUE && otherwise == BDD_FALSE) {
+		return condition;
+	}
+	if (then == BDD_FALSE && otherwise == BDD_TRUE) {
+		return condition ^ 1;
+	}
+	// The standard triple: the condition and "then" are not complemented.
+	if (condition & 1) {
+		const BddEdge swap = then;
+		condition ^= 1;
+		then = otherwise;
+		otherwise = swap;
+	}
+	const BddEdge complement = then & 1;
+	then ^= complement;
+	otherwise ^= complement;
+	CacheEntry * entry = &bddManager->cache[_hashTriple(condition, then, otherwise) & (bddManager->cacheSize - 1)];
+	++bddManager->statistics.cacheLookups;
+	if (entry->condition == condition && entry->then == then && entry->otherwise == otherwise) {
+		++bddManager->statistics.cacheHits;
+		return entry->result ^ complement;
+	}
+	unsigned int variable = bddManager->nodes[condition >> 1].variable;
+	unsigned int level = _level(bddManager, condition);
+	if (_level(bddManager, then) < level) {
+		variable = bddManager->nodes[then >> 1].variable;
+		level = _level(bddManager, then);
+	}
+	if (_level(bddManager, otherwise) < level) {
+		variable = bddManager->nodes[otherwise >> 1].variable;
+	}
+	BddEdge conditionHigh, conditionLow, thenHigh, thenLow, otherwiseHigh, otherwiseLow;
+	_cofactors(bddManager, condition, variable, &conditionHigh, &conditionLow);
+	_cofactors(bddManager, then, variable, &thenHigh, &thenLow);
+	_cofactors(bddManager, otherwise, variable, &otherwiseHigh, &otherwiseLow);
+	const BddEdge high = bddIte(bddManager, conditionHigh, thenHigh, otherwiseHigh);
+	const BddEdge low = bddIte(bddManager, conditionLow, thenLow, otherwiseLow);
+	const BddEdge result = _makeNode(bddManager, variable, high, low);
+	// The recursion may have grown (and moved) the cache.
+	entry = &bddManager->cache[_hashTriple(condition, then, otherwise) & (bddManager->cacheSize - 1)];
+	*entry = (CacheEntry) {
+		.condition = condition,
+		.then = then,
+		.otherwise = otherwise,
+		.result = result
+	};
+	return result ^ complement;
+}
+
+BddEdge bddApply(BddManager * bddManager, const Opcode opcode, const BddEdge left, const BddEdge right) {
+	switch (opcode) {
+		case NOT_OPERATION: return left ^ 1;
+		case AND_OPERATION: return bddIte(bddManager, left, right, BDD_FALSE);
+		case OR_OPERATION: return bddIte(bddManager, left, BDD_TRUE, right);
+		case THEN_OPERATION: return bddIte(bddManager, left, right, BDD_TRUE);
+		case IFF_OPERATION: return bddIte(bddManager, left, right, right ^ 1);
+		default:
+			logError(_logger, "The specified opcode cannot be applied: %d", opcode);
+			return BDD_FALSE;
+	}
+}
+
+BddEdge bddRestrict(BddManager * bddManager, const BddEdge edge, const unsigned int variable, const boolean value) {
+	const BddNode * node = &bddManager->nodes[edge >> 1];
+	if (bddManager->levels[variable] < _level(bddManager, edge)) {
+		return edge;
+	}
+	const BddEdge complement = edge & 1;
+	if (node->variable == variable) {
+		return (value ? node->high : node->low) ^ complement;
+	}
+	const BddEdge regular = edge ^ complement;
+	const BddEdge tag = RESTRICT_TAG - (value ? 1 : 0);
+	CacheEntry * entry = &bddManager->cache[_hashTriple(regular, variable, tag) & (bddManager->cacheSize - 1)];
+	++bddManager->statistics.cacheLookups;
+	if (entry->condition == regular && entry->then == variable && entry->otherwise == tag) {
+		++bddManager->statistics.cacheHits;
+		return entry->result ^ complement;
+	}
+	const unsigned int top = node->variable;
+	const BddEdge high = bddRestrict(bddManager, node->high, variable, value);
+	const BddEdge low = bddRestrict(bddManager, bddManager->nodes[regular >> 1].low, variable, value);
+	const BddEdge result = _makeNode(bddManager, top, high, low);
+	entry = &bddManager->cache[_hashTriple(regular, variable, tag) & (bddManager->cacheSize - 1)];
+	*entry = (CacheEntry) {
+		.condition = regular,
+		.then = variable,
+		.otherwise = tag,
+		.result = result
+	};
+	return result ^ complement;
+}
+
+unsigned int bddTopVariable(const BddManager * bddManager, const BddEdge edge) {
+	return bddManager->nodes[edge >> 1].variable;
+}
+
+BddEdge bddHigh(const BddManager * bddManager, const BddEdge edge) {
+	return (edge >> 1) == 0 ? edge : bddManager->nodes[edge >> 1].high ^ (edge & 1);
+}
+
+BddEdge bddLow(const BddManager * bddManager, const BddEdge edge) {
+	return (edge >> 1) == 0 ? edge : bddManager->nodes[edge >> 1].low ^ (edge & 1);
+}
+
+void bddReference(BddManager * bddManager, const BddEdge edge) {
+	++bddManager->nodes[edge >> 1].references;
+}
+
+void bddDereference(BddManager * bddManager, const BddEdge edge) {
+	--bddManager->nodes[edge >> 1].references;
+}
+
+boolean bddNeedsCollection(const BddManager * bddManager) {
+	return bddManager->collectionThreshold <= bddManager->aliveNodes;
+}
+
+void collectBddGarbage(BddManager * bddManager) {
+	unsigned char * marks = calloc(bddManager->nodeCount, sizeof(unsigned char));
+	marks[0] = 1;
+	for (unsigned int index = 1; index < bddManager->nodeCount; ++index) {
+		const BddNode * node = &bddManager->nodes[index];
+		if (node->variable != FREE_VARIABLE && 0 < node->references) {
+			_markNode(bddManager, index, marks);
+		}
+	}
+	const unsigned int before = bddManager->aliveNodes;
+	for (unsigned int index = 1; index < bddManager->nodeCount; ++index) {
+		BddNode * node = &bddManager->nodes[index];
+		if (node->variable != FREE_VARIABLE && !marks[index]) {
+			node->variable = FREE_VARIABLE;
+			node->next = bddManager->freeNodes;
+			bddManager->freeNodes = index;
+			--bddManager->aliveNodes;
+		}
+	}
+	free(marks);
+	_rehash(bddManager, bddManager->bucketCount);
+	_clearCache(bddManager);
+	// If most nodes are still alive, collecting again soon is pointless.
+	while (bddManager->collectionThreshold <= 2 * bddManager->aliveNodes) {
+		bddManager->collectionThreshold *= 2;
+	}
+	++bddManager->statistics.collections;
+	bddManager->statistics.collectedNodes += before - bddManager->aliveNodes;
+	logDebugging(_logger, "Garbage collection released %u of %u nodes.", before - bddManager->aliveNodes, before);
+}
+
+boolean bddNeedsReordering(const BddManager * bddManager) {
+	return bddManager->reorderingThreshold <= bddManager->aliveNodes;
+}
+
+void reorderBddVariables(BddManager * bddManager) {
+	collectBddGarbage(bddManager);
+	const unsigned int before = bddManager->aliveNodes;
+	const uint64_t swaps = bddManager->statistics.swaps;
+	bddManager->nodeLists = calloc(1 + bddManager->variableCount, sizeof(NodeList));
+	bddManager->compactions = calloc(bddManager->nodeCapacity, sizeof(unsigned int));
+	bddManager->compaction = 0;
+	bddManager->swapBudget = MAX_SIFTING_SWAPS_PER_VARIABLE * bddManager->variableCount;
+	for (unsigned int node = 1; node < bddManager->nodeCount; ++node) {
+		const BddNode * bddNode = &bddManager->nodes[node];
+		if (bddNode->variable != FREE_VARIABLE) {
+			++bddManager->nodes[bddNode->high >> 1].references;
+			++bddManager->nodes[bddNode->low >> 1].references;
+			_appendNode(bddManager, bddNode->variable, node);
+		}
+	}
+	VariableWeight * weights = calloc(1 + bddManager->variableCount, sizeof(VariableWeight));
+	for (unsigned int variable = 0; variable < bddManager->variableCount; ++variable) {
+		weights[variable].variable = variable;
+		weights[variable].nodeCount = bddManager->nodeLists[variable].count;
+	}
+	qsort(weights, bddManager->variableCount, sizeof(VariableWeight), _compareWeights);
+	for (unsigned int k = 0; k < bddManager->variableCount && 0 < weights[k].nodeCount && 0 < bddManager->swapBudget; ++k) {
+		_siftVariable(bddManager, weights[k].variable);
+	}
+	free(weights);
+	for (unsigned int node = 1; node < bddManager->nodeCount; ++node) {
+		const BddNode * bddNode = &bddManager->nodes[node];
+		if (bddNode->variable != FREE_VARIABLE) {
+			--bddManager->nodes[bddNode->high >> 1].references;
+			--bddManager->nodes[bddNode->low >> 1].references;
+		}
+	}
+	for (unsigned int variable = 0; variable < bddManager->variableCount; ++variable) {
+		free(bddManager->nodeLists[variable].nodes);
+	}
+	free(bddManager->nodeLists);
+	bddManager->nodeLists = NULL;
+	free(bddManager->compactions);
+	bddManager->compactions = NULL;
+	_clearCache(bddManager);
+	const boolean gainedLittle = (MIN_SIFTING_GAIN_DENOMINATOR - MIN_SIFTING_GAIN_NUMERATOR) * (uint64_t) before
+		< MIN_SIFTING_GAIN_DENOMINATOR * (uint64_t) bddManager->aliveNodes;
+	while (bddManager->reorderingThreshold <= (gainedLittle ? 4 : 2) * bddManager->aliveNodes) {
+		bddManager->reorderingThreshold *= 2;
+	}
+	++bddManager->statistics.reorderings;
+	bddManager->statistics.nodesBeforeReordering += before;
+	bddManager->statistics.nodesAfterReordering += bddManager->aliveNodes;
+	logDebugging(_logger, "Sifting %u variables took %llu swaps, and reduced the nodes from %u to %u.",
+		bddManager->variableCount, (unsigned long long) (bddManager->statistics.swaps - swaps), before, bddManager->aliveNodes);
+}
+
+boolean isBddEdgeAlive(const BddManager * bddManager, const BddEdge edge) {
+	return bddManager->nodes[edge >> 1].variable != FREE_VARIABLE;
+}
+
+void bddModelCount(const BddManager * bddManager, const BddEdge edge, const unsigned int * variables, const unsigned int count, Natural * models) {
+	const unsigned int variableCount = bddManager->variableCount;
+	ModelCounting modelCounting = {
+		.bddManager = bddManager,
+		.countedBelow = calloc(1 + variableCount, sizeof(unsigned int)),
+		.trues = calloc(bddManager->nodeCount, sizeof(Natural *)),
+		.falses = calloc(bddManager->nodeCount, sizeof(Natural *))
+	};
+	for (unsigned int k = 0; k < count; ++k) {
+		modelCounting.countedBelow[bddManager->levels[variables[k]]] = 1;
+	}
+	for (unsigned int level = variableCount; 0 < level; --level) {
+		modelCounting.countedBelow[level - 1] += modelCounting.countedBelow[level];
+	}
+	modelCounting.trues[0] = createNatural(1);
+	modelCounting.falses[0] = createNatural(0);
+	const unsigned int root = edge >> 1;
+	_countModels(&modelCounting, root);
+	const unsigned int rootLevel = root == 0 ? variableCount : bddManager->levels[bddManager->nodes[root].variable];
+	copyNatural(models, (edge & 1) ? modelCounting.falses[root] : modelCounting.trues[root]);
+	shiftNatural(models, count - modelCounting.countedBelow[rootLevel]);
+	for (unsigned int node = 0; node < bddManager->nodeCount; ++node) {
+		if (modelCounting.trues[node] != NULL) {
+			destroyNatural(modelCounting.trues[node]);
+			destroyNatural(modelCounting.falses[node]);
+		}
+	}
+	free(modelCounting.countedBelow);
+	free(modelCounting.trues);
+	free(modelCounting.falses);
+}
+
+unsigned int bddSize(BddManager * bddManager, const BddEdge edge) {
+	unsigned char * marks = calloc(bddManager->nodeCount, sizeof(unsigned char));
+	const unsigned int size = _countNodes(bddManager, edge, marks);
+	free(marks);
+	return size;
+}
+
+unsigned int bddNodeCount(const BddManager * bddManager) {
+	return bddManager->aliveNodes;
+}
+
+const BddStatistics * bddStatistics(const BddManager * bddManager) {
+	return &bddManager->statistics;
+}
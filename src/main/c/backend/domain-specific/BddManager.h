@@ -0,0 +1,189 @@
+#ifndef BDD_MANAGER_HEADER
+#define BDD_MANAGER_HEADER
+
+#include "../../shared/Environment.h"
+#include "../../shared/Logger.h"
+#include "../../shared/Natural.h"
+#include "../../shared/Type.h"
+#include "FormulaDag.h"
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Initialize module's internal state. */
+void initializeBddManagerModule();
+
+/** Shutdown module's internal state. */
+void shutdownBddManagerModule();
+
+/**
+ * An edge to a node of a BDD: the index of the node, shifted left once, and
+ * a complement bit (i.e., the lowest bit negates the function of the node).
+ * The node 0 is the terminal node, so there is a single constant.
+ */
+typedef unsigned int BddEdge;
+
+#define BDD_TRUE ((BddEdge) 0)
+#define BDD_FALSE ((BddEdge) 1)
+
+/**
+ * The variable of the terminal node, which is below every variable.
+ */
+#define BDD_TERMINAL_VARIABLE UINT_MAX
+
+/**
+ * The counters of a manager, since its creation.
+ */
+typedef struct {
+	uint64_t cacheLookups;
+	uint64_t cacheHits;
+	uint64_t collections;
+	uint64_t collectedNodes;
+	unsigned int peakNodes;
+
+	// The reorderings, their swaps of adjacent levels, and the nodes alive
+	// before and after each one (accumulated).
+	uint64_t reorderings;
+	uint64_t swaps;
+	uint64_t nodesBeforeReordering;
+	uint64_t nodesAfterReordering;
+} BddStatistics;
+
+/**
+ * A package of reduced ordered BDDs with complement edges. Every node lives
+ * in a unique table, so 2 edges are equal if, and only if, their functions
+ * are equal. The high edge of a node is never complemented, which keeps the
+ * representation canonical. The results of ITE are kept in a lossy computed
+ * cache. Every variable has a level (the level 0 is at the top), which
+ * "reorderBddVariables" may change.
+ *
+ * The nodes that are not reachable from a referenced edge are garbage, and
+ * "collectBddGarbage" releases them (only between operations, never during
+ * one of them).
+ */
+typedef struct BddManager BddManager;
+
+/**
+ * Creates an empty manager, without variables.
+ */
+BddManager * createBddManager();
+
+/**
+ * Destroy a manager, and every node.
+ */
+void destroyBddManager(BddManager * bddManager);
+
+/**
+ * Creates a new variable (in the level below every existing one), and
+ * returns its index.
+ */
+unsigned int newBddVariable(BddManager * bddManager);
+
+/**
+ * The amount of variables of the manager.
+ */
+unsigned int bddVariableCount(const BddManager * bddManager);
+
+/**
+ * The function that is true if, and only if, a variable is true.
+ */
+BddEdge bddVariable(BddManager * bddManager, const unsigned int variable);
+
+/**
+ * The negation of a function, in O(1).
+ */
+BddEdge bddNot(const BddEdge edge);
+
+/**
+ * If-then-else: the function that is "then" where "condition" is true, and
+ * "otherwise" elsewhere. Every connective is an ITE.
+ */
+BddEdge bddIte(BddManager * bddManager, const BddEdge condition, const BddEdge then, const BddEdge otherwise);
+
+/**
+ * A built-in connective over 2 functions (the right one is ignored for the
+ * NOT_OPERATION).
+ */
+BddEdge bddApply(BddManager * bddManager, const Opcode opcode, const BddEdge left, const BddEdge right);
+
+/**
+ * The cofactor of a function with respect to a value of a variable (i.e.,
+ * the function with that variable replaced by a constant). It takes O(1) if
+ * the level of the variable is not below the one of the top variable of the
+ * function.
+ */
+BddEdge bddRestrict(BddManager * bddManager, const BddEdge edge, const unsigned int variable, const boolean value);
+
+/**
+ * The top variable of a function (BDD_TERMINAL_VARIABLE if it's constant),
+ * and its cofactors with respect to that variable.
+ */
+unsigned int bddTopVariable(const BddManager * bddManager, const BddEdge edge);
+BddEdge bddHigh(const BddManager * bddManager, const BddEdge edge);
+BddEdge bddLow(const BddManager * bddManager, const BddEdge edge);
+
+/**
+ * Protects a function (and every node reachable from it) from the garbage
+ * collector, until it's dereferenced as many times as it was referenced.
+ */
+void bddReference(BddManager * bddManager, const BddEdge edge);
+void bddDereference(BddManager * bddManager, const BddEdge edge);
+
+/**
+ * Returns true if the manager grew enough since the last collection to make
+ * a new one worth it.
+ */
+boolean bddNeedsCollection(const BddManager * bddManager);
+
+/**
+ * Releases every node that is not reachable from a referenced edge, and
+ * empties the computed cache. Every unreferenced edge becomes invalid.
+ */
+void collectBddGarbage(BddManager * bddManager);
+
+/**
+ * Returns true if the manager grew enough since the last reordering to make
+ * a new one worth it.
+ */
+boolean bddNeedsReordering(const BddManager * bddManager);
+
+/**
+ * Reorders the variables with sifting (the variables with more nodes first),
+ * to reduce the amount of nodes alive, within a budget of swaps. It collects
+ * the garbage first, and then swaps adjacent levels in place, so every edge
+ * alive keeps its function (but the released ones become invalid, as in
+ * "collectBddGarbage"). A reordering that gains little delays the next one.
+ */
+void reorderBddVariables(BddManager * bddManager);
+
+/**
+ * Returns true if the node of an edge is alive (i.e., it was not released by
+ * the last collection).
+ */
+boolean isBddEdgeAlive(const BddManager * bddManager, const BddEdge edge);
+
+/**
+ * The amount of valuations of the specified variables (which must include
+ * every variable the function depends on) that satisfy a function. The count
+ * of each node is memoized for both polarities, so it takes time linear in
+ * the size of the function (times the cost of the arithmetic).
+ */
+void bddModelCount(const BddManager * bddManager, const BddEdge edge, const unsigned int * variables, const unsigned int count, Natural * models);
+
+/**
+ * The amount of nodes of a function (the terminal node included).
+ */
+unsigned int bddSize(BddManager * bddManager, const BddEdge edge);
+
+/**
+ * The amount of nodes alive in the manager.
+ */
+unsigned int bddNodeCount(const BddManager * bddManager);
+
+/**
+ * The counters of a manager.
+ */
+const BddStatistics * bddStatistics(const BddManager * bddManager);
+
+#endif
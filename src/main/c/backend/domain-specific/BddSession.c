@@ -0,0 +1,458 @@
+#include "BddSession.h"
+
+/* MODULE INTERNAL STATE */
+
+#define UNBUILT UINT_MAX
+
+/**
+ * The orders of the variables: by declaration, by the structure of the DAG
+ * (the variables go down in the order in which a depth-first walk of each
+ * formula finds them, the deepest operands first), or by the structure of
+ * the DAG, and then by sifting whenever the manager grows enough.
+ */
+typedef enum {
+	DECLARATION_ORDERING,
+	STATIC_ORDERING,
+	SIFTING_ORDERING
+} BddOrdering;
+
+static Logger * _logger = NULL;
+static BddOrdering _bddOrdering = STATIC_ORDERING;
+
+void initializeBddSessionModule() {
+	_logger = createLogger("BddSession");
+	const char * ordering = getStringOrDefault("BDD_ORDERING", "static");
+	if (strcmp(ordering, "declaration") == 0) {
+		_bddOrdering = DECLARATION_ORDERING;
+	}
+	else if (strcmp(ordering, "sifting") == 0) {
+		_bddOrdering = SIFTING_ORDERING;
+	}
+	else if (strcmp(ordering, "static") != 0) {
+		logWarning(_logger, "The BDD ordering \"%s\" is unknown (using \"static\").", ordering);
+	}
+}
+
+void shutdownBddSessionModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+struct BddSession {
+	const SymbolTable * symbolTable;
+	FormulaDag * formulaDag;
+	BddManager * bddManager;
+
+	// The BDD variable of each variable, by identifier ID (only for the
+	// undeclared ones when ordering by declaration: the ones declared before
+	// the session was created take their ordinal, and the rest of them go
+	// after, in order of use).
+	unsigned int * variables;
+	unsigned int identifierCapacity;
+	unsigned int declaredCount;
+
+	// The BDD of each node of the DAG (or UNBUILT), and the root of each
+	// formula (by ordinal), which is referenced.
+	BddEdge * edges;
+	unsigned int edgeCount;
+	BddEdge * roots;
+	unsigned int formulaCount;
+
+	// The nodes used by the current formula (maybe repeated), whose BDDs stay
+	// referenced until the formula is built (so they survive a collection or
+	// a reordering in the middle of it).
+	unsigned int * buildingNodes;
+	unsigned int buildingCount;
+	unsigned int buildingCapacity;
+};
+
+/**
+ * A node of the DAG waiting to be built, which is expanded once its operands
+ * are in the stack.
+ */
+typedef struct {
+	unsigned int node;
+	boolean expanded;
+} BuildingFrame;
+
+/**
+ * The state of "enumerateBddModels": the BDD variable of each column.
+ */
+typedef struct {
+	BddManager * bddManager;
+	const CompiledFormula * compiledFormula;
+	unsigned int * variables;
+	ModelConsumer consumer;
+	void * context;
+	uint64_t models;
+} BddEnumeration;
+
+/* PRIVATE FUNCTIONS */
+
+static BddEdge _buildNodes(BddSession * bddSession, const unsigned int root);
+static BddEdge _buildOperator(BddSession * bddSession, const DagNode * application);
+static void _collectGarbage(BddSession * bddSession);
+static void _enumerate(BddEnumeration * bddEnumeration, const unsigned int column, const BddEdge edge, const uint64_t valuation);
+static void _growTables(BddSession * bddSession);
+static void _maintain(BddSession * bddSession);
+static void _orderVariables(BddSession * bddSession, const unsigned int root, unsigned char * visited);
+
+/**
+ * Builds the BDDs of the nodes of the DAG below a root that were not built
+ * yet, in post-order, with an explicit stack of nodes: a node is expanded the
+ * first time it's on top, and it's built the next time, once its operands
+ * have BDDs. Every node reached (built before or not) stays referenced until
+ * the formula is built. Returns the BDD of the root.
+ */
+static BddEdge _buildNodes(BddSession * bddSession, const unsigned int root) {
+	unsigned int capacity = 64;
+	unsigned int size = 0;
+	BuildingFrame * stack = malloc(capacity * sizeof(BuildingFrame));
+	stack[size++] = (BuildingFrame) {.node = root, .expanded = false};
+	while (0 < size) {
+		BuildingFrame * frame = &stack[size - 1];
+		const unsigned int node = frame->node;
+		const DagNode current = dagNode(bddSession->formulaDag, node);
+		BddEdge edge = bddSession->edges[node];
+		const boolean unbuilt = edge == UNBUILT;
+		if (unbuilt && !frame->expanded && current.opcode != LOAD_VARIABLE) {
+			frame->expanded = true;
+			const unsigned int operandCount = dagOperandCount(&current);
+			if (capacity < size + operandCount) {
+				capacity = 2 * (size + operandCount);
+				stack = realloc(stack, capacity * sizeof(BuildingFrame));
+			}
+			for (unsigned int k = operandCount; 0 < k; --k) {
+				stack[size++] = (BuildingFrame) {.node = dagOperand(&current, k - 1), .expanded = false};
+			}
+			continue;
+		}
+		--size;
+		if (unbuilt) {
+			switch (current.opcode) {
+				case LOAD_VARIABLE:
+					edge = bddVariable(bddSession->bddManager, bddSessionVariable(bddSession, current.variable));
+					break;
+				case NOT_OPERATION:
+					edge = bddNot(bddSession->edges[current.left]);
+					break;
+				case CUSTOM_OPERATION:
+					edge = _buildOperator(bddSession, &current);
+					break;
+				default:
+					edge = bddApply(bddSession->bddManager, current.opcode, bddSession->edges[current.left], bddSession->edges[current.right]);
+					break;
+			}
+			bddSession->edges[node] = edge;
+		}
+		if (bddSession->buildingCount == bddSession->buildingCapacity) {
+			bddSession->buildingCapacity = bddSession->buildingCapacity == 0 ? 64 : 2 * bddSession->buildingCapacity;
+			bddSession->buildingNodes = realloc(bddSession->buildingNodes, bddSession->buildingCapacity * sizeof(unsigned int));
+		}
+		bddSession->buildingNodes[bddSession->buildingCount++] = node;
+		bddReference(bddSession->bddManager, edge);
+		if (unbuilt && current.opcode != LOAD_VARIABLE) {
+			_maintain(bddSession);
+		}
+	}
+	free(stack);
+	return bddSession->edges[root];
+}
+
+/**
+ * Builds the BDD of an application of a custom operator as the disjunction of
+ * the cubes of the smaller of its covers (negated, if it's the cover of
+ * false). Its arguments are already built (and referenced), because the
+ * partial images are not referenced.
+ */
+static BddEdge _buildOperator(BddSession * bddSession, const DagNode * application) {
+	BddManager * bddManager = bddSession->bddManager;
+	const OperatorTable * operator = application->operator;
+	const boolean negated = operator->falseCover->count < operator->trueCover->count;
+	const CubeCover * cover = negated ? operator->falseCover : operator->trueCover;
+	BddEdge image = BDD_FALSE;
+	for (unsigned int c = 0; c < cover->count; ++c) {
+		const Cube cube = cover->cubes[c];
+		BddEdge product = BDD_TRUE;
+		for (uint64_t care = cube.care; care != 0; care &= care - 1) {
+			const unsigned int k = __builtin_ctzll(care);
+			const BddEdge argument = bddSession->edges[application->arguments[k]];
+			product = bddApply(bddManager, AND_OPERATION, product, ((cube.values >> k) & 1) ? argument : bddNot(argument));
+		}
+		image = bddApply(bddManager, OR_OPERATION, image, product);
+	}
+	return negated ? bddNot(image) : image;
+}
+
+/**
+ * Collects the garbage of the manager, and forgets the BDDs of the nodes of
+ * the DAG that were released (they will be built again if needed).
+ */
+static void _collectGarbage(BddSession * bddSession) {
+	collectBddGarbage(bddSession->bddManager);
+	for (unsigned int node = 0; node < bddSession->edgeCount; ++node) {
+		if (bddSession->edges[node] != UNBUILT && !isBddEdgeAlive(bddSession->bddManager, bddSession->edges[node])) {
+			bddSession->edges[node] = UNBUILT;
+		}
+	}
+}
+
+/**
+ * Enumerates the models below a BDD, assigning the columns in order (first
+ * false, then true), so the models come out in order of index.
+ */
+static void _enumerate(BddEnumeration * bddEnumeration, const unsigned int column, const BddEdge edge, const uint64_t valuation) {
+	if (edge == BDD_FALSE) {
+		return;
+	}
+	const CompiledFormula * compiledFormula = bddEnumeration->compiledFormula;
+	if (column == compiledFormula->variableCount) {
+		bddEnumeration->consumer(compiledFormula, valuation, bddEnumeration->context);
+		++bddEnumeration->models;
+		return;
+	}
+	const unsigned int variable = bddEnumeration->variables[column];
+	const uint64_t bit = 1ull << (compiledFormula->variableCount - 1 - column);
+	_enumerate(bddEnumeration, column + 1, bddRestrict(bddEnumeration->bddManager, edge, variable, false), valuation);
+	_enumerate(bddEnumeration, column + 1, bddRestrict(bddEnumeration->bddManager, edge, variable, true), valuation | bit);
+}
+
+/**
+ * Grows the BDD variables by identifier, and the roots by ordinal, to cover
+ * the symbols defined since the last call (in streaming mode, the session may
+ * be created before them).
+ */
+static void _growTables(BddSession * bddSession) {
+	const unsigned int identifiers = identifierCount();
+	if (bddSession->variables == NULL || bddSession->identifierCapacity < identifiers) {
+		bddSession->variables = realloc(bddSession->variables, (1 + identifiers) * sizeof(unsigned int));
+		memset(&bddSession->variables[bddSession->identifierCapacity], 0xFF,
+			(1 + identifiers - bddSession->identifierCapacity) * sizeof(unsigned int));
+		bddSession->identifierCapacity = identifiers;
+	}
+	const unsigned int formulaCount = symbolCount(bddSession->symbolTable, FORMULA_SYMBOL);
+	if (bddSession->roots == NULL || bddSession->formulaCount < formulaCount) {
+		bddSession->roots = realloc(bddSession->roots, (1 + formulaCount) * sizeof(BddEdge));
+		memset(&bddSession->roots[bddSession->formulaCount], 0xFF,
+			(1 + formulaCount - bddSession->formulaCount) * sizeof(BddEdge));
+		bddSession->formulaCount = formulaCount;
+	}
+}
+
+/**
+ * Collects the garbage or reorders the variables if the manager grew enough.
+ * It's only called between nodes of the DAG, where every BDD in use is
+ * referenced.
+ */
+static void _maintain(BddSession * bddSession) {
+	BddManager * bddManager = bddSession->bddManager;
+	if (_bddOrdering == SIFTING_ORDERING && bddNeedsReordering(bddManager)) {
+		// The garbage goes first, and then every BDD left is referenced, since
+		// the nodes released by a swap may be reused for other functions.
+		_collectGarbage(bddSession);
+		for (unsigned int node = 0; node < bddSession->edgeCount; ++node) {
+			if (bddSession->edges[node] != UNBUILT) {
+				bddReference(bddManager, bddSession->edges[node]);
+			}
+		}
+		reorderBddVariables(bddManager);
+		for (unsigned int node = 0; node < bddSession->edgeCount; ++node) {
+			if (bddSession->edges[node] != UNBUILT) {
+				bddDereference(bddManager, bddSession->edges[node]);
+			}
+		}
+	}
+	else if (bddNeedsCollection(bddManager)) {
+		_collectGarbage(bddSession);
+	}
+}
+
+/**
+ * Creates the variables of a formula that don't have a BDD variable yet, in
+ * the order in which a depth-first walk of its DAG finds them, visiting the
+ * deepest operands first (so the variables that interact the most end up
+ * close to each other). The walk keeps the nodes to visit in an explicit
+ * stack, where the operand to visit first goes on top.
+ */
+static void _orderVariables(BddSession * bddSession, const unsigned int root, unsigned char * visited) {
+	FormulaDag * formulaDag = bddSession->formulaDag;
+	unsigned int capacity = 64;
+	unsigned int size = 0;
+	unsigned int * stack = malloc(capacity * sizeof(unsigned int));
+	stack[size++] = root;
+	while (0 < size) {
+		const unsigned int node = stack[--size];
+		if (visited[node]) {
+			continue;
+		}
+		visited[node] = 1;
+		const DagNode current = dagNode(formulaDag, node);
+		const unsigned int operandCount = dagOperandCount(&current);
+		if (capacity < size + operandCount) {
+			capacity = 2 * (size + operandCount);
+			stack = realloc(stack, capacity * sizeof(unsigned int));
+		}
+		switch (current.opcode) {
+			case LOAD_VARIABLE:
+				bddSessionVariable(bddSession, current.variable);
+				break;
+			case NOT_OPERATION:
+				stack[size++] = current.left;
+				break;
+			case CUSTOM_OPERATION:
+				// The arguments are variables, so they go in order.
+				for (unsigned int k = operandCount; 0 < k; --k) {
+					stack[size++] = current.arguments[k - 1];
+				}
+				break;
+			default:
+				if (dagAttributes(formulaDag, current.left)->depth < dagAttributes(formulaDag, current.right)->depth) {
+					stack[size++] = current.left;
+					stack[size++] = current.right;
+				}
+				else {
+					stack[size++] = current.right;
+					stack[size++] = current.left;
+				}
+				break;
+		}
+	}
+	free(stack);
+}
+
+/* PUBLIC FUNCTIONS */
+
+BddSession * createBddSession(const SymbolTable * symbolTable, FormulaDag * formulaDag) {
+	BddSession * bddSession = calloc(1, sizeof(BddSession));
+	bddSession->symbolTable = symbolTable;
+	bddSession->formulaDag = formulaDag;
+	bddSession->bddManager = createBddManager();
+	if (_bddOrdering == DECLARATION_ORDERING) {
+		bddSession->declaredCount = symbolCount(symbolTable, VARIABLE_SYMBOL);
+		for (unsigned int k = 0; k < bddSession->declaredCount; ++k) {
+			newBddVariable(bddSession->bddManager);
+		}
+	}
+	_growTables(bddSession);
+	return bddSession;
+}
+
+void destroyBddSession(BddSession * bddSession) {
+	if (bddSession != NULL) {
+		const BddStatistics * statistics = bddStatistics(bddSession->bddManager);
+		logDebugging(_logger, "Session closed with %u nodes alive (%u at most), %llu collections, and %llu of %llu cache hits.",
+			bddNodeCount(bddSession->bddManager), statistics->peakNodes, (unsigned long long) statistics->collections,
+			(unsigned long long) statistics->cacheHits, (unsigned long long) statistics->cacheLookups);
+		if (0 < statistics->reorderings) {
+			logDebugging(_logger, "Sifting ran %llu times (%llu swaps), and reduced the nodes from %llu to %llu in total.",
+				(unsigned long long) statistics->reorderings, (unsigned long long) statistics->swaps,
+				(unsigned long long) statistics->nodesBeforeReordering, (unsigned long long) statistics->nodesAfterReordering);
+		}
+		destroyBddManager(bddSession->bddManager);
+		free(bddSession->variables);
+		free(bddSession->edges);
+		free(bddSession->roots);
+		free(bddSession->buildingNodes);
+		free(bddSession);
+	}
+}
+
+BddEdge bddSessionFormula(BddSession * bddSession, const CompiledFormula * compiledFormula) {
+	const Symbol * symbol = lookupSymbol(bddSession->symbolTable, FORMULA_SYMBOL, compiledFormula->name);
+	_growTables(bddSession);
+	BddEdge * root = &bddSession->roots[symbol->ordinal];
+	if (*root != UNBUILT) {
+		return *root;
+	}
+	const unsigned int nodeCount = dagNodeCount(bddSession->formulaDag);
+	if (bddSession->edgeCount < nodeCount) {
+		bddSession->edges = realloc(bddSession->edges, nodeCount * sizeof(BddEdge));
+		memset(&bddSession->edges[bddSession->edgeCount], 0xFF, (nodeCount - bddSession->edgeCount) * sizeof(BddEdge));
+		bddSession->edgeCount = nodeCount;
+	}
+	// Between 2 formulas, only the roots are in use.
+	_maintain(bddSession);
+	const unsigned int formula = dagFormula(bddSession->formulaDag, compiledFormula->name);
+	if (_bddOrdering != DECLARATION_ORDERING) {
+		unsigned char * visited = calloc(nodeCount, sizeof(unsigned char));
+		_orderVariables(bddSession, formula, visited);
+		free(visited);
+	}
+	*root = _buildNodes(bddSession, formula);
+	bddReference(bddSession->bddManager, *root);
+	for (unsigned int k = 0; k < bddSession->buildingCount; ++k) {
+		bddDereference(bddSession->bddManager, bddSession->edges[bddSession->buildingNodes[k]]);
+	}
+	bddSession->buildingCount = 0;
+	logDebugging(_logger, "Formula \"%s\" built into a BDD of %u nodes (%u nodes alive).", compiledFormula->name->name,
+		bddSize(bddSession->bddManager, *root), bddNodeCount(bddSession->bddManager));
+	return *root;
+}
+
+BddEdge bddSessionConnective(BddSession * bddSession, const Opcode opcode, const BddEdge left, const BddEdge right) {
+	return bddApply(bddSession->bddManager, opcode, left, right);
+}
+
+unsigned int bddSessionVariable(BddSession * bddSession, const Identifier * variable) {
+	if (_bddOrdering == DECLARATION_ORDERING) {
+		const Symbol * symbol = lookupSymbol(bddSession->symbolTable, VARIABLE_SYMBOL, variable);
+		if (symbol != NULL && symbol->ordinal < bddSession->declaredCount) {
+			return symbol->ordinal;
+		}
+	}
+	_growTables(bddSession);
+	if (bddSession->variables[variable->id] == UINT_MAX) {
+		bddSession->variables[variable->id] = newBddVariable(bddSession->bddManager);
+	}
+	return bddSession->variables[variable->id];
+}
+
+boolean * bddSessionWitness(const BddSession * bddSession, BddEdge edge) {
+	if (edge == BDD_FALSE) {
+		return NULL;
+	}
+	const BddManager * bddManager = bddSession->bddManager;
+	boolean * values = calloc(1 + bddVariableCount(bddManager), sizeof(boolean));
+	// A reduced BDD that is not BDD_FALSE always has a path to BDD_TRUE, and
+	// so does one of its cofactors.
+	while (edge != BDD_TRUE) {
+		const BddEdge low = bddLow(bddManager, edge);
+		if (low != BDD_FALSE) {
+			edge = low;
+		}
+		else {
+			values[bddTopVariable(bddManager, edge)] = true;
+			edge = bddHigh(bddManager, edge);
+		}
+	}
+	return values;
+}
+
+uint64_t enumerateBddModels(BddSession * bddSession, const CompiledFormula * compiledFormula, ModelConsumer consumer, void * context) {
+	const BddEdge root = bddSessionFormula(bddSession, compiledFormula);
+	BddEnumeration bddEnumeration = {
+		.bddManager = bddSession->bddManager,
+		.compiledFormula = compiledFormula,
+		.variables = calloc(1 + compiledFormula->variableCount, sizeof(unsigned int)),
+		.consumer = consumer,
+		.context = context,
+		.models = 0
+	};
+	for (unsigned int column = 0; column < compiledFormula->variableCount; ++column) {
+		bddEnumeration.variables[column] = bddSessionVariable(bddSession, compiledFormula->variables[column]);
+	}
+	_enumerate(&bddEnumeration, 0, root, 0);
+	free(bddEnumeration.variables);
+	return bddEnumeration.models;
+}
+
+void countBddModels(BddSession * bddSession, const CompiledFormula * compiledFormula, Natural * models) {
+	const BddEdge root = bddSessionFormula(bddSession, compiledFormula);
+	unsigned int * variables = calloc(1 + compiledFormula->variableCount, sizeof(unsigned int));
+	for (unsigned int column = 0; column < compiledFormula->variableCount; ++column) {
+		variables[column] = bddSessionVariable(bddSession, compiledFormula->variables[column]);
+	}
+	bddModelCount(bddSession->bddManager, root, variables, compiledFormula->variableCount, models);
+	free(variables);
+}
@@ -0,0 +1,85 @@
+#ifndef BDD_SESSION_HEADER
+#define BDD_SESSION_HEADER
+
+#include "../../shared/Environment.h"
+#include "../../shared/Identifier.h"
+#include "../../shared/Logger.h"
+#include "../../shared/SymbolTable.h"
+#include "../../shared/Type.h"
+#include "BddManager.h"
+#include "FormulaDag.h"
+#include "TruthTableEngine.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Initialize module's internal state. */
+void initializeBddSessionModule();
+
+/** Shutdown module's internal state. */
+void shutdownBddSessionModule();
+
+/**
+ * A BDD manager that lives as long as the execution of a program, with the
+ * BDD of every formula built so far. The BDDs are built from the DAG of the
+ * program, node by node, so a subformula shared by several formulas is only
+ * built once (unless it was collected in between). The variables of the
+ * program are ordered as "BDD_ORDERING" says: by declaration (the undeclared
+ * ones go last, in order of appearance), by the structure of the DAG, or by
+ * the structure of the DAG and then by sifting, whenever the nodes alive
+ * grow enough.
+ */
+typedef struct BddSession BddSession;
+
+/**
+ * Creates an empty session for the program of a symbol table, and its DAG.
+ */
+BddSession * createBddSession(const SymbolTable * symbolTable, FormulaDag * formulaDag);
+
+/**
+ * Destroy a session, and its manager.
+ */
+void destroyBddSession(BddSession * bddSession);
+
+/**
+ * The BDD of a formula, building it the first time (it stays referenced
+ * until the session is destroyed). Since the BDDs are canonical, a formula is
+ * a tautology if, and only if, its BDD is BDD_TRUE, and 2 formulas are
+ * congruent if, and only if, their BDDs are equal.
+ */
+BddEdge bddSessionFormula(BddSession * bddSession, const CompiledFormula * compiledFormula);
+
+/**
+ * The BDD of a built-in connective over 2 BDDs of the session. The result is
+ * not referenced, so it's only valid until the next formula is built.
+ */
+BddEdge bddSessionConnective(BddSession * bddSession, const Opcode opcode, const BddEdge left, const BddEdge right);
+
+/**
+ * The BDD variable of a variable of the program.
+ */
+unsigned int bddSessionVariable(BddSession * bddSession, const Identifier * variable);
+
+/**
+ * A satisfying valuation of a BDD, with a value per BDD variable (the
+ * variables that don't matter are false). Returns NULL if the BDD is
+ * BDD_FALSE. The caller must free the valuation.
+ */
+boolean * bddSessionWitness(const BddSession * bddSession, const BddEdge edge);
+
+/**
+ * Analog to "enumerateModels", but walking the BDD of the formula: every
+ * branch of the walk leads to at least one model, so it takes time linear in
+ * the amount of models (times the amount of variables), no matter how many
+ * valuations the formula has.
+ */
+uint64_t enumerateBddModels(BddSession * bddSession, const CompiledFormula * compiledFormula, ModelConsumer consumer, void * context);
+
+/**
+ * Analog to "countFormulaModels", but counting over the BDD of the formula,
+ * in time linear in its size (once it's built), no matter how many models or
+ * variables it has.
+ */
+void countBddModels(BddSession * bddSession, const CompiledFormula * compiledFormula, Natural * models);
+
+#endif
@@ -0,0 +1,484 @@
+#include "CnfEncoder.h"
+
+/* MODULE INTERNAL STATE */
+
+static Logger * _logger = NULL;
+
+void initializeCnfEncoderModule() {
+	_logger = createLogger("CnfEncoder");
+}
+
+void shutdownCnfEncoderModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/**
+ * A connective of the encoding, with its operands (for the custom operators,
+ * the arguments live in the argument pool of the builder), its variable, and
+ * the polarities already defined.
+ */
+typedef struct {
+	Opcode opcode;
+	Literal left;
+	Literal right;
+	const OperatorTable * operator;
+	size_t argumentOffset;
+
+	Literal output;
+	unsigned char polarities;
+} Node;
+
+struct CnfBuilder {
+	ClauseConsumer consumer;
+	void * context;
+	unsigned int variableCount;
+	uint64_t clauseCount;
+
+	// The clause being emitted.
+	Literal clause[MAX_OPERATOR_ARITY + 1];
+
+	// The connectives, and a hash table of their indexes (open addressing,
+	// with a power-of-2 amount of buckets).
+	Node * nodes;
+	unsigned int nodeCount;
+	unsigned int nodeCapacity;
+	unsigned int * buckets;
+	unsigned int bucketCount;
+
+	Literal * arguments;
+	size_t argumentCount;
+	size_t argumentCapacity;
+};
+
+#define EMPTY_BUCKET UINT_MAX
+
+/* PRIVATE FUNCTIONS */
+
+static void _addClause(CnfBuilder * cnfBuilder, const unsigned int count, ...);
+static void _appendClause(const Literal * literals, const unsigned int count, void * context);
+static Literal _buildNode(CnfBuilder * cnfBuilder, const Node * key, const Literal * arguments, const Polarity polarity);
+static void _defineNode(CnfBuilder * cnfBuilder, const Node * node, const unsigned char polarity);
+static void _emitClause(CnfBuilder * cnfBuilder, const unsigned int count);
+static void _encodeOperator(CnfBuilder * cnfBuilder, const Node * node, const unsigned char polarity);
+static unsigned int _findBucket(const CnfBuilder * cnfBuilder, const Node * key, const Literal * arguments);
+static void _growBuckets(CnfBuilder * cnfBuilder);
+static uint64_t _hashNode(const Node * node, const Literal * arguments);
+static unsigned char * _polarities(const CompiledFormula * compiledFormula, const Polarity polarity);
+
+/**
+ * Emits a clause with the specified literals.
+ */
+static void _addClause(CnfBuilder * cnfBuilder, const unsigned int count, ...) {
+	va_list arguments;
+	va_start(arguments, count);
+	for (unsigned int k = 0; k < count; ++k) {
+		cnfBuilder->clause[k] = va_arg(arguments, Literal);
+	}
+	va_end(arguments);
+	_emitClause(cnfBuilder, count);
+}
+
+/**
+ * The consumer that keeps the clauses of an encoding in memory.
+ */
+static void _appendClause(const Literal * literals, const unsigned int count, void * context) {
+	Cnf * cnf = context;
+	if (cnf->literalCapacity < cnf->literalCount + count + 1) {
+		while (cnf->literalCapacity < cnf->literalCount + count + 1) {
+			cnf->literalCapacity = cnf->literalCapacity == 0 ? 1024 : 2 * cnf->literalCapacity;
+		}
+		cnf->literals = realloc(cnf->literals, cnf->literalCapacity * sizeof(Literal));
+	}
+	memcpy(&cnf->literals[cnf->literalCount], literals, count * sizeof(Literal));
+	cnf->literalCount += count;
+	cnf->literals[cnf->literalCount++] = 0;
+}
+
+/**
+ * Returns the variable of a connective, creating it the first time, and
+ * emitting the clauses of the polarities that were not defined yet.
+ */
+static Literal _buildNode(CnfBuilder * cnfBuilder, const Node * key, const Literal * arguments, const Polarity polarity) {
+	if (2 * cnfBuilder->bucketCount <= 3 * (1 + cnfBuilder->nodeCount)) {
+		_growBuckets(cnfBuilder);
+	}
+	const unsigned int bucket = _findBucket(cnfBuilder, key, arguments);
+	if (cnfBuilder->buckets[bucket] == EMPTY_BUCKET) {
+		if (cnfBuilder->nodeCount == cnfBuilder->nodeCapacity) {
+			cnfBuilder->nodeCapacity = cnfBuilder->nodeCapacity == 0 ? 64 : 2 * cnfBuilder->nodeCapacity;
+			cnfBuilder->nodes = realloc(cnfBuilder->nodes, cnfBuilder->nodeCapacity * sizeof(Node));
+		}
+		Node * node = &cnfBuilder->nodes[cnfBuilder->nodeCount];
+		*node = *key;
+		if (key->opcode == CUSTOM_OPERATION) {
+			const unsigned int arity = key->operator->arity;
+			if (cnfBuilder->argumentCapacity < cnfBuilder->argumentCount + arity) {
+				while (cnfBuilder->argumentCapacity < cnfBuilder->argumentCount + arity) {
+					cnfBuilder->argumentCapacity = cnfBuilder->argumentCapacity == 0 ? 64 : 2 * cnfBuilder->argumentCapacity;
+				}
+				cnfBuilder->arguments = realloc(cnfBuilder->arguments, cnfBuilder->argumentCapacity * sizeof(Literal));
+			}
+			node->argumentOffset = cnfBuilder->argumentCount;
+			memcpy(&cnfBuilder->arguments[cnfBuilder->argumentCount], arguments, arity * sizeof(Literal));
+			cnfBuilder->argumentCount += arity;
+		}
+		node->output = newCnfVariable(cnfBuilder);
+		node->polarities = 0;
+		cnfBuilder->buckets[bucket] = cnfBuilder->nodeCount++;
+	}
+	Node * node = &cnfBuilder->nodes[cnfBuilder->buckets[bucket]];
+	const unsigned char missing = polarity & ~node->polarities;
+	if (missing != 0) {
+		node->polarities |= missing;
+		_defineNode(cnfBuilder, node, missing);
+	}
+	return node->output;
+}
+
+/**
+ * Emits the clauses that define a connective in the specified polarities.
+ */
+static void _defineNode(CnfBuilder * cnfBuilder, const Node * node, const unsigned char polarity) {
+	const Literal output = node->output;
+	const Literal left = node->left;
+	const Literal right = node->right;
+	const boolean positive = polarity & POSITIVE_POLARITY;
+	const boolean negative = polarity & NEGATIVE_POLARITY;
+	switch (node->opcode) {
+		case AND_OPERATION:
+			if (positive) {
+				_addClause(cnfBuilder, 2, -output, left);
+				_addClause(cnfBuilder, 2, -output, right);
+			}
+			if (negative) {
+				_addClause(cnfBuilder, 3, output, -left, -right);
+			}
+			break;
+		case OR_OPERATION:
+			if (positive) {
+				_addClause(cnfBuilder, 3, -output, left, right);
+			}
+			if (negative) {
+				_addClause(cnfBuilder, 2, output, -left);
+				_addClause(cnfBuilder, 2, output, -right);
+			}
+			break;
+		case THEN_OPERATION:
+			if (positive) {
+				_addClause(cnfBuilder, 3, -output, -left, right);
+			}
+			if (negative) {
+				_addClause(cnfBuilder, 2, output, left);
+				_addClause(cnfBuilder, 2, output, -right);
+			}
+			break;
+		case IFF_OPERATION:
+			if (positive) {
+				_addClause(cnfBuilder, 3, -output, -left, right);
+				_addClause(cnfBuilder, 3, -output, left, -right);
+			}
+			if (negative) {
+				_addClause(cnfBuilder, 3, output, left, right);
+				_addClause(cnfBuilder, 3, output, -left, -right);
+			}
+			break;
+		case CUSTOM_OPERATION:
+			_encodeOperator(cnfBuilder, node, polarity);
+			break;
+		default:
+			logError(_logger, "The specified opcode is unknown: %d", node->opcode);
+			break;
+	}
+}
+
+/**
+ * Emits the clause of the builder, without its repeated literals. The
+ * tautological clauses (that appear when an operand is repeated, as in
+ * "p & !p") are dropped.
+ */
+static void _emitClause(CnfBuilder * cnfBuilder, const unsigned int count) {
+	unsigned int size = 0;
+	for (unsigned int k = 0; k < count; ++k) {
+		boolean repeated = false;
+		for (unsigned int j = 0; j < size; ++j) {
+			if (cnfBuilder->clause[j] == -cnfBuilder->clause[k]) {
+				return;
+			}
+			repeated = repeated || cnfBuilder->clause[j] == cnfBuilder->clause[k];
+		}
+		if (!repeated) {
+			cnfBuilder->clause[size++] = cnfBuilder->clause[k];
+		}
+	}
+	++cnfBuilder->clauseCount;
+	if (cnfBuilder->consumer != NULL) {
+		cnfBuilder->consumer(cnfBuilder->clause, size, cnfBuilder->context);
+	}
+}
+
+/**
+ * Encodes a custom operator with one clause per cube of its minimized covers:
+ * if the arguments are in a cube, the output takes the image of its cover.
+ * Only the cover whose image is needed by the polarity is encoded.
+ */
+static void _encodeOperator(CnfBuilder * cnfBuilder, const Node * node, const unsigned char polarity) {
+	const Literal * arguments = &cnfBuilder->arguments[node->argumentOffset];
+	for (signed char image = 0; image < 2; ++image) {
+		if (!(polarity & (image ? NEGATIVE_POLARITY : POSITIVE_POLARITY))) {
+			continue;
+		}
+		const CubeCover * cover = image ? node->operator->trueCover : node->operator->falseCover;
+		for (unsigned int c = 0; c < cover->count; ++c) {
+			const Cube cube = cover->cubes[c];
+			unsigned int count = 0;
+			for (uint64_t care = cube.care; care != 0; care &= care - 1) {
+				const unsigned int k = __builtin_ctzll(care);
+				cnfBuilder->clause[count++] = ((cube.values >> k) & 1) ? -arguments[k] : arguments[k];
+			}
+			cnfBuilder->clause[count++] = image ? node->output : -node->output;
+			_emitClause(cnfBuilder, count);
+		}
+	}
+}
+
+/**
+ * Returns the bucket of a connective, or the empty bucket where it should be
+ * inserted.
+ */
+static unsigned int _findBucket(const CnfBuilder * cnfBuilder, const Node * key, const Literal * arguments) {
+	const unsigned int mask = cnfBuilder->bucketCount - 1;
+	unsigned int bucket = _hashNode(key, arguments) & mask;
+	while (cnfBuilder->buckets[bucket] != EMPTY_BUCKET) {
+		const Node * node = &cnfBuilder->nodes[cnfBuilder->buckets[bucket]];
+		if (node->opcode == key->opcode && node->left == key->left && node->right == key->right && node->operator == key->operator) {
+			if (key->opcode != CUSTOM_OPERATION
+				|| memcmp(&cnfBuilder->arguments[node->argumentOffset], arguments, key->operator->arity * sizeof(Literal)) == 0) {
+				return bucket;
+			}
+		}
+		bucket = (bucket + 1) & mask;
+	}
+	return bucket;
+}
+
+/**
+ * Doubles the amount of buckets, and hashes every connective again.
+ */
+static void _growBuckets(CnfBuilder * cnfBuilder) {
+	cnfBuilder->bucketCount = cnfBuilder->bucketCount == 0 ? 256 : 2 * cnfBuilder->bucketCount;
+	free(cnfBuilder->buckets);
+	cnfBuilder->buckets = malloc(cnfBuilder->bucketCount * sizeof(unsigned int));
+	memset(cnfBuilder->buckets, 0xFF, cnfBuilder->bucketCount * sizeof(unsigned int));
+	const unsigned int mask = cnfBuilder->bucketCount - 1;
+	for (unsigned int k = 0; k < cnfBuilder->nodeCount; ++k) {
+		const Node * node = &cnfBuilder->nodes[k];
+		const Literal * arguments = node->opcode == CUSTOM_OPERATION ? &cnfBuilder->arguments[node->argumentOffset] : NULL;
+		unsigned int bucket = _hashNode(node, arguments) & mask;
+		while (cnfBuilder->buckets[bucket] != EMPTY_BUCKET) {
+			bucket = (bucket + 1) & mask;
+		}
+		cnfBuilder->buckets[bucket] = k;
+	}
+}
+
+/**
+ * Hashes the operands of a connective (FNV-1a over 32-bit words).
+ */
+static uint64_t _hashNode(const Node * node, const Literal * arguments) {
+	uint64_t hash = 0xCBF29CE484222325ull;
+	hash = (hash ^ (uint32_t) node->opcode) * 0x100000001B3ull;
+	hash = (hash ^ (uint32_t) node->left) * 0x100000001B3ull;
+	hash = (hash ^ (uint32_t) node->right) * 0x100000001B3ull;
+	if (node->opcode == CUSTOM_OPERATION) {
+		hash = (hash ^ node->operator->name->hash) * 0x100000001B3ull;
+		for (unsigned int k = 0; k < node->operator->arity; ++k) {
+			hash = (hash ^ (uint32_t) arguments[k]) * 0x100000001B3ull;
+		}
+	}
+	return hash ^ (hash >> 29);
+}
+
+/**
+ * Computes the polarities of every register, from the root down to the
+ * variables. Each instruction only reads previous registers, so a single
+ * backward pass is enough.
+ */
+static unsigned char * _polarities(const CompiledFormula * compiledFormula, const Polarity polarity) {
+	unsigned char * polarities = calloc(compiledFormula->instructionCount, sizeof(unsigned char));
+	polarities[compiledFormula->instructionCount - 1] = polarity;
+	for (unsigned int k = compiledFormula->instructionCount; 0 < k--;) {
+		const Instruction * instruction = &compiledFormula->instructions[k];
+		const unsigned char current = polarities[k];
+		const unsigned char flipped = ((current & POSITIVE_POLARITY) << 1) | ((current & NEGATIVE_POLARITY) >> 1);
+		if (current == 0) {
+			continue;
+		}
+		switch (instruction->opcode) {
+			case NOT_OPERATION:
+				polarities[instruction->left] |= flipped;
+				break;
+			case AND_OPERATION:
+			case OR_OPERATION:
+				polarities[instruction->left] |= current;
+				polarities[instruction->right] |= current;
+				break;
+			case THEN_OPERATION:
+				polarities[instruction->left] |= flipped;
+				polarities[instruction->right] |= current;
+				break;
+			case IFF_OPERATION:
+				polarities[instruction->left] = BOTH_POLARITIES;
+				polarities[instruction->right] = BOTH_POLARITIES;
+				break;
+			case CUSTOM_OPERATION:
+				for (unsigned int a = 0; a < instruction->operator->arity; ++a) {
+					polarities[instruction->arguments[a]] = BOTH_POLARITIES;
+				}
+				break;
+			default:
+				break;
+		}
+	}
+	return polarities;
+}
+
+/* PUBLIC FUNCTIONS */
+
+CnfBuilder * createCnfBuilder(ClauseConsumer consumer, void * context) {
+	CnfBuilder * cnfBuilder = calloc(1, sizeof(CnfBuilder));
+	cnfBuilder->consumer = consumer;
+	cnfBuilder->context = context;
+	_growBuckets(cnfBuilder);
+	return cnfBuilder;
+}
+
+void destroyCnfBuilder(CnfBuilder * cnfBuilder) {
+	if (cnfBuilder != NULL) {
+		free(cnfBuilder->arguments);
+		free(cnfBuilder->buckets);
+		free(cnfBuilder->nodes);
+		free(cnfBuilder);
+	}
+}
+
+Literal newCnfVariable(CnfBuilder * cnfBuilder) {
+	return ++cnfBuilder->variableCount;
+}
+
+unsigned int cnfVariableCount(const CnfBuilder * cnfBuilder) {
+	return cnfBuilder->variableCount;
+}
+
+uint64_t cnfClauseCount(const CnfBuilder * cnfBuilder) {
+	return cnfBuilder->clauseCount;
+}
+
+Literal buildConnective(CnfBuilder * cnfBuilder, const Opcode opcode, const Literal left, const Literal right, const Polarity polarity) {
+	if (opcode == NOT_OPERATION) {
+		return -left;
+	}
+	if ((opcode == AND_OPERATION || opcode == OR_OPERATION) && left == right) {
+		return left;
+	}
+	// The commutative connectives take their operands in order.
+	const boolean swap = opcode != THEN_OPERATION && right < left;
+	const Node key = {
+		.opcode = opcode,
+		.left = swap ? right : left,
+		.right = swap ? left : right,
+		.operator = NULL,
+		.argumentOffset = 0
+	};
+	return _buildNode(cnfBuilder, &key, NULL, polarity);
+}
+
+Literal buildFormula(CnfBuilder * cnfBuilder, const CompiledFormula * compiledFormula, const Literal * columns, const Polarity polarity) {
+	unsigned char * polarities = _polarities(compiledFormula, polarity);
+	// The literal of every register.
+	Literal * registers = calloc(compiledFormula->instructionCount, sizeof(Literal));
+	Literal arguments[MAX_OPERATOR_ARITY];
+	for (unsigned int k = 0; k < compiledFormula->instructionCount; ++k) {
+		const Instruction * instruction = &compiledFormula->instructions[k];
+		if (instruction->opcode == LOAD_VARIABLE) {
+			registers[k] = columns[instruction->left];
+		}
+		else if (polarities[k] == 0) {
+			continue;
+		}
+		else if (instruction->opcode == CUSTOM_OPERATION) {
+			const OperatorTable * operator = instruction->operator;
+			for (unsigned int a = 0; a < operator->arity; ++a) {
+				arguments[a] = registers[instruction->arguments[a]];
+			}
+			const Node key = {
+				.opcode = CUSTOM_OPERATION,
+				.left = 0,
+				.right = 0,
+				.operator = operator,
+				.argumentOffset = 0
+			};
+			registers[k] = _buildNode(cnfBuilder, &key, arguments, polarities[k]);
+		}
+		else {
+			registers[k] = buildConnective(cnfBuilder, instruction->opcode,
+				registers[instruction->left], registers[instruction->right], polarities[k]);
+		}
+	}
+	const Literal root = registers[compiledFormula->instructionCount - 1];
+	free(registers);
+	free(polarities);
+	return root;
+}
+
+boolean streamFormula(const CompiledFormula * compiledFormula, const Polarity polarity, ClauseConsumer consumer, void * context, CnfHeader * cnfHeader) {
+	CnfBuilder * cnfBuilder = createCnfBuilder(consumer, context);
+	Literal * columns = calloc(1 + compiledFormula->variableCount, sizeof(Literal));
+	for (unsigned int column = 0; column < compiledFormula->variableCount; ++column) {
+		columns[column] = newCnfVariable(cnfBuilder);
+	}
+	const Literal root = buildFormula(cnfBuilder, compiledFormula, columns, polarity);
+	*cnfHeader = (CnfHeader) {
+		.variableCount = cnfVariableCount(cnfBuilder),
+		.columnCount = compiledFormula->variableCount,
+		.clauseCount = cnfClauseCount(cnfBuilder),
+		.root = root
+	};
+	if (root != 0) {
+		logDebugging(_logger, "Formula \"%s\" encoded into %u variables and %llu clauses.",
+			compiledFormula->name->name, cnfHeader->variableCount, (unsigned long long) cnfHeader->clauseCount);
+	}
+	free(columns);
+	destroyCnfBuilder(cnfBuilder);
+	return root != 0;
+}
+
+Cnf * encodeFormula(const CompiledFormula * compiledFormula, const Polarity polarity) {
+	Cnf * cnf = calloc(1, sizeof(Cnf));
+	if (!streamFormula(compiledFormula, polarity, _appendClause, cnf, &cnf->header)) {
+		destroyCnf(cnf);
+		return NULL;
+	}
+	return cnf;
+}
+
+void destroyCnf(Cnf * cnf) {
+	if (cnf != NULL) {
+		free(cnf->literals);
+		free(cnf);
+	}
+}
+
+void loadCnf(SatSolver * satSolver, const Cnf * cnf) {
+	while (satVariableCount(satSolver) < cnf->header.variableCount) {
+		newSatVariable(satSolver);
+	}
+	size_t start = 0;
+	for (size_t k = 0; k < cnf->literalCount; ++k) {
+		if (cnf->literals[k] == 0) {
+			addSatClause(satSolver, &cnf->literals[start], k - start);
+			start = k + 1;
+		}
+	}
+}
@@ -0,0 +1,143 @@
+#ifndef CNF_ENCODER_HEADER
+#define CNF_ENCODER_HEADER
+
+#include "../../shared/Logger.h"
+#include "../../shared/Type.h"
+#include "SatSolver.h"
+#include "TruthTableEngine.h"
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Initialize module's internal state. */
+void initializeCnfEncoderModule();
+
+/** Shutdown module's internal state. */
+void shutdownCnfEncoderModule();
+
+/**
+ * The polarities in which a subformula occurs: positive if it must imply its
+ * definition, negative if its definition must imply it, or both (a full
+ * equivalence). The root of a formula that will be asserted is positive, and
+ * the one of a formula that will be negated is negative.
+ */
+typedef enum {
+	POSITIVE_POLARITY = 1,
+	NEGATIVE_POLARITY = 2,
+	BOTH_POLARITIES = 3
+} Polarity;
+
+/**
+ * The size of a CNF formula, equisatisfiable with the original one once the
+ * root literal is asserted (or negated, depending on the polarity of the
+ * encoding). The first variables are the columns of the compiled formula, in
+ * the same order (i.e., the column "c" is the variable "c + 1"); the rest of
+ * them are auxiliary. The clause that asserts the root isn't included.
+ */
+typedef struct {
+	unsigned int variableCount;
+	unsigned int columnCount;
+	uint64_t clauseCount;
+
+	// The literal that is true if, and only if, the formula is true.
+	Literal root;
+} CnfHeader;
+
+/**
+ * A CNF formula kept in memory.
+ */
+typedef struct {
+	CnfHeader header;
+
+	// The clauses one after another, each one terminated by a 0 (as in the
+	// DIMACS format).
+	Literal * literals;
+	size_t literalCount;
+	size_t literalCapacity;
+} Cnf;
+
+/**
+ * Receives every clause of an encoding, as soon as it's produced. The
+ * literals are only valid during the call.
+ */
+typedef void (*ClauseConsumer)(const Literal * literals, const unsigned int count, void * context);
+
+/**
+ * An encoding that grows formula by formula, streaming its clauses to a
+ * consumer. Every connective is hashed by its operands (i.e., structural
+ * hashing), so a subformula that appears many times, in one formula or in
+ * several ones, takes a single variable and is only defined once.
+ */
+typedef struct CnfBuilder CnfBuilder;
+
+/**
+ * Creates an empty encoding, without variables. The consumer can be NULL, to
+ * only count the clauses.
+ */
+CnfBuilder * createCnfBuilder(ClauseConsumer consumer, void * context);
+
+/**
+ * Destroy an encoding (the clauses already belong to the consumer).
+ */
+void destroyCnfBuilder(CnfBuilder * cnfBuilder);
+
+/**
+ * Creates a new variable (e.g., for a variable of the program), and returns
+ * it as a positive literal.
+ */
+Literal newCnfVariable(CnfBuilder * cnfBuilder);
+
+/**
+ * The amount of variables, and of clauses emitted so far.
+ */
+unsigned int cnfVariableCount(const CnfBuilder * cnfBuilder);
+uint64_t cnfClauseCount(const CnfBuilder * cnfBuilder);
+
+/**
+ * Returns the literal of a built-in connective over 2 literals (the right one
+ * is ignored for the NOT_OPERATION), defined at least in the specified
+ * polarities. The same connective over the same operands (in any order, if
+ * it's commutative) always returns the same literal.
+ */
+Literal buildConnective(CnfBuilder * cnfBuilder, const Opcode opcode, const Literal left, const Literal right, const Polarity polarity);
+
+/**
+ * Encodes a compiled formula with the Plaisted-Greenbaum transformation, and
+ * returns its root: every connective gets a variable, defined only in the
+ * polarities in which it occurs (the transformation of Tseitin, with both
+ * polarities everywhere, doubles the clauses). The custom operators occur in
+ * both polarities, and their truth tables are encoded cube by cube, from
+ * their minimized covers. The columns are the literals of the variables of
+ * the formula.
+ */
+Literal buildFormula(CnfBuilder * cnfBuilder, const CompiledFormula * compiledFormula, const Literal * columns, const Polarity polarity);
+
+/**
+ * Encodes a single compiled formula, where the column "c" is the variable "c
+ * + 1". The clauses are streamed to the consumer, so the encoding only takes
+ * memory linear in the size of the compiled formula. The same formula and
+ * polarity always produce the same clauses. Returns false if the formula
+ * cannot be encoded.
+ */
+boolean streamFormula(const CompiledFormula * compiledFormula, const Polarity polarity, ClauseConsumer consumer, void * context, CnfHeader * cnfHeader);
+
+/**
+ * Analog to "streamFormula", but keeping the clauses in memory. Returns NULL
+ * if the formula cannot be encoded.
+ */
+Cnf * encodeFormula(const CompiledFormula * compiledFormula, const Polarity polarity);
+
+/**
+ * Destroy a CNF formula.
+ */
+void destroyCnf(Cnf * cnf);
+
+/**
+ * Adds the clauses of a CNF to a solver without variables, creating every
+ * variable of the CNF (so the variables keep their numbers).
+ */
+void loadCnf(SatSolver * satSolver, const Cnf * cnf);
+
+#endif
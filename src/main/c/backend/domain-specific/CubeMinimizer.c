@@ -0,0 +1,114 @@
+#include "CubeMinimizer.h"
+
+/* MODULE INTERNAL STATE */
+
+static Logger * _logger = NULL;
+
+void initializeCubeMinimizerModule() {
+	_logger = createLogger("CubeMinimizer");
+}
+
+void shutdownCubeMinimizerModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/* PRIVATE FUNCTIONS */
+
+static int _compareBiggerFirst(const void * cube, const void * other);
+static int _compareSmallerFirst(const void * cube, const void * other);
+static Cube _expand(const Cube cube, const CubeCover * offSet);
+static boolean _intersectsCover(const Cube cube, const CubeCover * cubeCover);
+static void _removeRedundant(CubeCover * cubeCover);
+
+/**
+ * Orders the cubes from the one with less cares (i.e., more inputs).
+ */
+static int _compareBiggerFirst(const void * cube, const void * other) {
+	const int cares = __builtin_popcountll(((const Cube *) cube)->care);
+	const int otherCares = __builtin_popcountll(((const Cube *) other)->care);
+	return cares - otherCares;
+}
+
+/**
+ * Orders the cubes from the one with more cares (i.e., less inputs).
+ */
+static int _compareSmallerFirst(const void * cube, const void * other) {
+	return _compareBiggerFirst(other, cube);
+}
+
+/**
+ * Frees the arguments of a cube, one at a time, while it stays out of the
+ * off-set. The result is a prime implicant.
+ */
+static Cube _expand(const Cube cube, const CubeCover * offSet) {
+	Cube expanded = cube;
+	for (uint64_t care = cube.care; care != 0; care &= care - 1) {
+		const uint64_t argument = care & -care;
+		const Cube candidate = {.care = expanded.care & ~argument, .values = expanded.values & ~argument};
+		if (!_intersectsCover(candidate, offSet)) {
+			expanded = candidate;
+		}
+	}
+	return expanded;
+}
+
+/**
+ * Returns true if a cube shares an input with some cube of a cover.
+ */
+static boolean _intersectsCover(const Cube cube, const CubeCover * cubeCover) {
+	for (unsigned int k = 0; k < cubeCover->count; ++k) {
+		if (cubesIntersect(cube, cubeCover->cubes[k])) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Removes the cubes that the rest of the cover holds, from the smallest one.
+ * Each cube is swapped with the last one, so the rest of the cover is its
+ * prefix.
+ */
+static void _removeRedundant(CubeCover * cubeCover) {
+	qsort(cubeCover->cubes, cubeCover->count, sizeof(Cube), _compareSmallerFirst);
+	for (unsigned int k = 0; k < cubeCover->count;) {
+		const unsigned int last = cubeCover->count - 1;
+		const Cube cube = cubeCover->cubes[k];
+		cubeCover->cubes[k] = cubeCover->cubes[last];
+		cubeCover->cubes[last] = cube;
+		const CubeCover rest = {.cubes = cubeCover->cubes, .count = last, .capacity = 0};
+		uint64_t input = 0;
+		if (findUncoveredInput(&rest, cube, &input)) {
+			cubeCover->cubes[last] = cubeCover->cubes[k];
+			cubeCover->cubes[k++] = cube;
+		}
+		else {
+			--cubeCover->count;
+		}
+	}
+}
+
+/* PUBLIC FUNCTIONS */
+
+void minimizeCover(CubeCover * cubeCover, const CubeCover * offSet) {
+	const unsigned int initialCount = cubeCover->count;
+	qsort(cubeCover->cubes, cubeCover->count, sizeof(Cube), _compareBiggerFirst);
+	for (unsigned int k = 0; k < cubeCover->count; ++k) {
+		const Cube expanded = _expand(cubeCover->cubes[k], offSet);
+		cubeCover->cubes[k] = expanded;
+		for (unsigned int other = k + 1; other < cubeCover->count;) {
+			if (cubeContains(expanded, cubeCover->cubes[other])) {
+				// Keeps the order of the rest of the cubes.
+				memmove(&cubeCover->cubes[other], &cubeCover->cubes[other + 1], (cubeCover->count - other - 1) * sizeof(Cube));
+				--cubeCover->count;
+			}
+			else {
+				++other;
+			}
+		}
+	}
+	_removeRedundant(cubeCover);
+	logDebugging(_logger, "A cover of %u cubes was minimized into %u cubes.", initialCount, cubeCover->count);
+}
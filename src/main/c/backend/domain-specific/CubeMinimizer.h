@@ -0,0 +1,27 @@
+#ifndef CUBE_MINIMIZER_HEADER
+#define CUBE_MINIMIZER_HEADER
+
+#include "../../shared/CubeCover.h"
+#include "../../shared/Logger.h"
+#include "../../shared/Type.h"
+#include <stdint.h>
+#include <stdlib.h>
+
+/** Initialize module's internal state. */
+void initializeCubeMinimizerModule();
+
+/** Shutdown module's internal state. */
+void shutdownCubeMinimizerModule();
+
+/**
+ * Minimizes a cover in place, with a pass of the heuristics of Espresso. The
+ * off-set must cover exactly the inputs out of the cover (i.e., both covers
+ * partition the inputs). First, each cube is expanded, freeing its arguments
+ * one at a time while it stays out of the off-set, and the cubes inside an
+ * expanded cube are dropped. Then, from the smallest cube, the cubes that
+ * the rest of the cover already holds are removed. The result is a cover of
+ * the same inputs, made of prime and irredundant cubes.
+ */
+void minimizeCover(CubeCover * cubeCover, const CubeCover * offSet);
+
+#endif
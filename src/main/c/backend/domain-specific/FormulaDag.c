@@ -0,0 +1,718 @@
+#include "FormulaDag.h"
+
+/* MODULE INTERNAL STATE */
+
+#define EMPTY_BUCKET UINT_MAX
+#define IN_PROGRESS (UINT_MAX - 1)
+#define UNVISITED (UINT_MAX - 2)
+
+static Logger * _logger = NULL;
+
+void initializeFormulaDagModule() {
+	_logger = createLogger("FormulaDag");
+}
+
+void shutdownFormulaDagModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+struct FormulaDag {
+	const SymbolTable * symbolTable;
+
+	// Where the truth tables of the custom operators, and the attributes of
+	// the nodes live.
+	Arena * arena;
+
+	// The nodes, as a struct of arrays in topological order: the opcode and
+	// the 2 operands of each one. A load takes the index of its variable as
+	// the left operand, and a custom operation takes the ordinal of its
+	// operator as the left operand, and the offset of its first argument as
+	// the right one.
+	uint8_t * opcodes;
+	uint32_t * lefts;
+	uint32_t * rights;
+	unsigned int nodeCount;
+	unsigned int nodeCapacity;
+
+	// The arguments of every custom operation, one after the other.
+	uint32_t * arguments;
+	unsigned int argumentCount;
+	unsigned int argumentCapacity;
+
+	// A hash table of the indexes of the nodes (open addressing, with a
+	// power-of-2 amount of buckets).
+	unsigned int * buckets;
+	unsigned int bucketCount;
+
+	// The root of each predefined formula, by ordinal (or UNVISITED,
+	// IN_PROGRESS or INVALID_DAG_NODE).
+	unsigned int * formulas;
+	unsigned int formulaCount;
+
+	// The truth table of each custom operator, by ordinal.
+	OperatorTable ** operators;
+	unsigned int operatorCount;
+
+	// The variables of the nodes, by order of appearance, and the index of
+	// each one, by identifier ID (or UINT_MAX).
+	const Identifier ** variables;
+	unsigned int variableCount;
+	unsigned int variableCapacity;
+	unsigned int * variableIndexes;
+	unsigned int identifierCapacity;
+
+	// The attributes of each node (or NULL, until some query needs them).
+	DagAttributes ** attributes;
+	unsigned int attributeCount;
+
+	// The amount of expressions of the AST lowered so far.
+	uint64_t expressionCount;
+};
+
+/**
+ * The encoded operands of a node to intern, as in the arrays of the DAG (the
+ * arguments are only read for a custom operation, and they are as many as
+ * the arity of its operator).
+ */
+typedef struct {
+	Opcode opcode;
+	uint32_t left;
+	uint32_t right;
+	const uint32_t * arguments;
+} NodeKey;
+
+/**
+ * An expression of a formula waiting to be lowered, or the definition of a
+ * formula (if the expression is NULL). It's expanded once its operands are
+ * in the stack, so it's lowered the next time it's on top.
+ */
+typedef struct {
+	const Symbol * formula;
+	const Expression * expression;
+	boolean expanded;
+} LoweringFrame;
+
+/**
+ * The state of the lowering of a formula: the expressions waiting, and the
+ * nodes of the expressions already lowered.
+ */
+typedef struct {
+	LoweringFrame * frames;
+	unsigned int frameCount;
+	unsigned int frameCapacity;
+	unsigned int * nodes;
+	unsigned int nodeCount;
+	unsigned int nodeCapacity;
+} Lowering;
+
+/* PRIVATE FUNCTIONS */
+
+static void _analyzeNode(FormulaDag * formulaDag, const unsigned int node);
+static unsigned int _findBucket(const FormulaDag * formulaDag, const NodeKey * key);
+static void _growBuckets(FormulaDag * formulaDag);
+static void _growTables(FormulaDag * formulaDag);
+static uint64_t _hashKey(const FormulaDag * formulaDag, const NodeKey * key);
+static unsigned int _internNode(FormulaDag * formulaDag, const NodeKey * key);
+static unsigned int _lowerApplication(FormulaDag * formulaDag, const Identifier * formulaName, const CustomOperator * application);
+static void _lowerFormula(FormulaDag * formulaDag, const Symbol * symbol);
+static const OperatorTable * _lowerOperator(FormulaDag * formulaDag, const Symbol * symbol);
+static unsigned int _makeNode(FormulaDag * formulaDag, const Opcode opcode, const unsigned int left, const unsigned int right);
+static NodeKey _nodeKey(const FormulaDag * formulaDag, const unsigned int node);
+static void _pushFrame(Lowering * lowering, const LoweringFrame frame);
+static void _pushNode(Lowering * lowering, const unsigned int node);
+static unsigned int _variableIndex(FormulaDag * formulaDag, const Identifier * variable);
+
+/**
+ * Computes the attributes of a node, whose operands already have them.
+ */
+static void _analyzeNode(FormulaDag * formulaDag, const unsigned int node) {
+	const DagNode current = dagNode(formulaDag, node);
+	const unsigned int operandCount = dagOperandCount(&current);
+	DagAttributes * attributes = allocateInArena(formulaDag->arena, 1, sizeof(DagAttributes));
+	attributes->complexity = createNatural(current.opcode == LOAD_VARIABLE ? 0 : 1);
+	attributes->binaryComplexity = createNatural(operandCount == 2 ? 1 : 0);
+	attributes->depth = 0;
+	attributes->supportWords = current.opcode == LOAD_VARIABLE ? 1 + current.left / 64 : 0;
+	for (unsigned int k = 0; k < operandCount; ++k) {
+		const DagAttributes * operand = formulaDag->attributes[dagOperand(&current, k)];
+		addNatural(attributes->complexity, operand->complexity);
+		addNatural(attributes->binaryComplexity, operand->binaryComplexity);
+		attributes->depth = attributes->depth < 1 + operand->depth ? 1 + operand->depth : attributes->depth;
+		attributes->supportWords = attributes->supportWords < operand->supportWords ? operand->supportWords : attributes->supportWords;
+	}
+	uint64_t * support = allocateInArena(formulaDag->arena, attributes->supportWords, sizeof(uint64_t));
+	if (current.opcode == LOAD_VARIABLE) {
+		support[current.left / 64] |= 1ull << (current.left % 64);
+	}
+	for (unsigned int k = 0; k < operandCount; ++k) {
+		const DagAttributes * operand = formulaDag->attributes[dagOperand(&current, k)];
+		for (unsigned int word = 0; word < operand->supportWords; ++word) {
+			support[word] |= operand->support[word];
+		}
+	}
+	attributes->support = support;
+	attributes->supportSize = 0;
+	for (unsigned int word = 0; word < attributes->supportWords; ++word) {
+		attributes->supportSize += __builtin_popcountll(support[word]);
+	}
+	formulaDag->attributes[node] = attributes;
+}
+
+/**
+ * Returns the bucket of a node, or the empty bucket where it should be
+ * inserted.
+ */
+static unsigned int _findBucket(const FormulaDag * formulaDag, const NodeKey * key) {
+	const unsigned int mask = formulaDag->bucketCount - 1;
+	unsigned int bucket = _hashKey(formulaDag, key) & mask;
+	while (formulaDag->buckets[bucket] != EMPTY_BUCKET) {
+		const unsigned int node = formulaDag->buckets[bucket];
+		if (formulaDag->opcodes[node] == key->opcode && formulaDag->lefts[node] == key->left) {
+			if (key->opcode != CUSTOM_OPERATION) {
+				if (formulaDag->rights[node] == key->right) {
+					return bucket;
+				}
+			}
+			else if (memcmp(&formulaDag->arguments[formulaDag->rights[node]], key->arguments,
+					formulaDag->operators[key->left]->arity * sizeof(uint32_t)) == 0) {
+				return bucket;
+			}
+		}
+		bucket = (bucket + 1) & mask;
+	}
+	return bucket;
+}
+
+/**
+ * Doubles the amount of buckets, and hashes every node again.
+ */
+static void _growBuckets(FormulaDag * formulaDag) {
+	formulaDag->bucketCount = formulaDag->bucketCount == 0 ? 256 : 2 * formulaDag->bucketCount;
+	free(formulaDag->buckets);
+	formulaDag->buckets = malloc(formulaDag->bucketCount * sizeof(unsigned int));
+	memset(formulaDag->buckets, 0xFF, formulaDag->bucketCount * sizeof(unsigned int));
+	const unsigned int mask = formulaDag->bucketCount - 1;
+	for (unsigned int k = 0; k < formulaDag->nodeCount; ++k) {
+		const NodeKey key = _nodeKey(formulaDag, k);
+		unsigned int bucket = _hashKey(formulaDag, &key) & mask;
+		while (formulaDag->buckets[bucket] != EMPTY_BUCKET) {
+			bucket = (bucket + 1) & mask;
+		}
+		formulaDag->buckets[bucket] = k;
+	}
+}
+
+/**
+ * Grows the tables indexed by formula, operator and identifier, to cover the
+ * symbols declared since the last call (when statements are streamed, the
+ * symbol table keeps growing after the DAG is created).
+ */
+static void _growTables(FormulaDag * formulaDag) {
+	const unsigned int formulaCount = symbolCount(formulaDag->symbolTable, FORMULA_SYMBOL);
+	if (formulaDag->formulas == NULL || formulaDag->formulaCount < formulaCount) {
+		formulaDag->formulas = realloc(formulaDag->formulas, (1 + formulaCount) * sizeof(unsigned int));
+		for (unsigned int k = formulaDag->formulaCount; k < formulaCount; ++k) {
+			formulaDag->formulas[k] = UNVISITED;
+		}
+		formulaDag->formulaCount = formulaCount;
+	}
+	const unsigned int operatorCount = symbolCount(formulaDag->symbolTable, OPERATOR_SYMBOL);
+	if (formulaDag->operators == NULL || formulaDag->operatorCount < operatorCount) {
+		formulaDag->operators = realloc(formulaDag->operators, (1 + operatorCount) * sizeof(OperatorTable *));
+		memset(&formulaDag->operators[formulaDag->operatorCount], 0,
+			(1 + operatorCount - formulaDag->operatorCount) * sizeof(OperatorTable *));
+		formulaDag->operatorCount = operatorCount;
+	}
+	const unsigned int identifiers = identifierCount();
+	if (formulaDag->variableIndexes == NULL || formulaDag->identifierCapacity < identifiers) {
+		formulaDag->variableIndexes = realloc(formulaDag->variableIndexes, (1 + identifiers) * sizeof(unsigned int));
+		memset(&formulaDag->variableIndexes[formulaDag->identifierCapacity], 0xFF,
+			(1 + identifiers - formulaDag->identifierCapacity) * sizeof(unsigned int));
+		formulaDag->identifierCapacity = identifiers;
+	}
+}
+
+/**
+ * Hashes the operands of a node (FNV-1a over 32-bit words).
+ */
+static uint64_t _hashKey(const FormulaDag * formulaDag, const NodeKey * key) {
+	uint64_t hash = 0xCBF29CE484222325ull;
+	hash = (hash ^ (uint64_t) key->opcode) * 0x100000001B3ull;
+	hash = (hash ^ (uint64_t) key->left) * 0x100000001B3ull;
+	if (key->opcode != CUSTOM_OPERATION) {
+		hash = (hash ^ (uint64_t) key->right) * 0x100000001B3ull;
+	}
+	else {
+		for (unsigned int k = 0; k < formulaDag->operators[key->left]->arity; ++k) {
+			hash = (hash ^ (uint64_t) key->arguments[k]) * 0x100000001B3ull;
+		}
+	}
+	return hash ^ (hash >> 32);
+}
+
+/**
+ * Returns the index of a node, creating it the first time. The arguments of
+ * a new custom operation are appended to the pool of arguments.
+ */
+static unsigned int _internNode(FormulaDag * formulaDag, const NodeKey * key) {
+	if (2 * formulaDag->bucketCount <= 3 * (1 + formulaDag->nodeCount)) {
+		_growBuckets(formulaDag);
+	}
+	const unsigned int bucket = _findBucket(formulaDag, key);
+	if (formulaDag->buckets[bucket] == EMPTY_BUCKET) {
+		if (formulaDag->nodeCount == formulaDag->nodeCapacity) {
+			formulaDag->nodeCapacity = formulaDag->nodeCapacity == 0 ? 64 : 2 * formulaDag->nodeCapacity;
+			formulaDag->opcodes = realloc(formulaDag->opcodes, formulaDag->nodeCapacity * sizeof(uint8_t));
+			formulaDag->lefts = realloc(formulaDag->lefts, formulaDag->nodeCapacity * sizeof(uint32_t));
+			formulaDag->rights = realloc(formulaDag->rights, formulaDag->nodeCapacity * sizeof(uint32_t));
+		}
+		const unsigned int node = formulaDag->nodeCount++;
+		formulaDag->opcodes[node] = (uint8_t) key->opcode;
+		formulaDag->lefts[node] = key->left;
+		formulaDag->rights[node] = key->right;
+		if (key->opcode == CUSTOM_OPERATION) {
+			const unsigned int arity = formulaDag->operators[key->left]->arity;
+			if (formulaDag->argumentCapacity < formulaDag->argumentCount + arity) {
+				formulaDag->argumentCapacity = 2 * (formulaDag->argumentCount + arity);
+				formulaDag->arguments = realloc(formulaDag->arguments, formulaDag->argumentCapacity * sizeof(uint32_t));
+			}
+			memcpy(&formulaDag->arguments[formulaDag->argumentCount], key->arguments, arity * sizeof(uint32_t));
+			formulaDag->rights[node] = formulaDag->argumentCount;
+			formulaDag->argumentCount += arity;
+		}
+		formulaDag->buckets[bucket] = node;
+	}
+	return formulaDag->buckets[bucket];
+}
+
+/**
+ * Lowers an application of a custom operator (whose arguments are variables),
+ * and returns its node (or INVALID_DAG_NODE if the operator is undefined).
+ */
+static unsigned int _lowerApplication(FormulaDag * formulaDag, const Identifier * formulaName, const CustomOperator * application) {
+	const Symbol * symbol = lookupSymbol(formulaDag->symbolTable, OPERATOR_SYMBOL, application->name);
+	if (symbol == NULL) {
+		logError(_logger, "The formula \"%s\" applies the undefined operator \"%s\".", formulaName->name, application->name->name);
+		return INVALID_DAG_NODE;
+	}
+	const OperatorTable * operator = _lowerOperator(formulaDag, symbol);
+	const VariableList * variableList = application->variableList;
+	uint32_t * arguments = calloc(1 + operator->arity, sizeof(uint32_t));
+	for (unsigned int k = 0; k < operator->arity && k < variableList->count; ++k) {
+		const NodeKey load = {.opcode = LOAD_VARIABLE, .left = _variableIndex(formulaDag, variableList->variables[k]), .right = 0};
+		arguments[k] = _internNode(formulaDag, &load);
+	}
+	const NodeKey key = {.opcode = CUSTOM_OPERATION, .left = symbol->ordinal, .right = 0, .arguments = arguments};
+	const unsigned int node = _internNode(formulaDag, &key);
+	free(arguments);
+	return node;
+}
+
+/**
+ * Lowers the definition of a formula, and the ones it references that were
+ * not lowered yet, in post-order: every expression waits in an explicit stack
+ * (in heap-memory) until its operands are lowered, and their nodes wait in
+ * another stack. Hence, neither the nesting of the expressions nor the chains
+ * of references grow the native stack. The root of each formula (or
+ * INVALID_DAG_NODE, if it cannot be lowered) is kept once its definition is
+ * lowered.
+ */
+static void _lowerFormula(FormulaDag * formulaDag, const Symbol * symbol) {
+	Lowering lowering = {
+		.frames = NULL,
+		.frameCount = 0,
+		.frameCapacity = 0,
+		.nodes = NULL,
+		.nodeCount = 0,
+		.nodeCapacity = 0
+	};
+	const LoweringFrame formula = {.formula = symbol, .expression = NULL, .expanded = false};
+	_pushFrame(&lowering, formula);
+	while (0 < lowering.frameCount) {
+		LoweringFrame * frame = &lowering.frames[lowering.frameCount - 1];
+		const Identifier * formulaName = frame->formula->name;
+		if (frame->expression == NULL) {
+			// The definition of a formula: first it's lowered, and then its root
+			// (the last node lowered) is kept.
+			unsigned int * root = &formulaDag->formulas[frame->formula->ordinal];
+			if (frame->expanded) {
+				*root = lowering.nodes[lowering.nodeCount - 1];
+				--lowering.frameCount;
+			}
+			else {
+				const DefineFormula * defineFormula = frame->formula->definition;
+				const LoweringFrame definition = {.formula = frame->formula, .expression = defineFormula->expression, .expanded = false};
+				*root = IN_PROGRESS;
+				frame->expanded = true;
+				_pushFrame(&lowering, definition);
+			}
+			continue;
+		}
+		const Expression * expression = frame->expression;
+		if (frame->expanded) {
+			// The operands are lowered, and their nodes are on top.
+			--lowering.frameCount;
+			if (expression->type == NOT_EXPRESSION) {
+				const unsigned int operand = lowering.nodes[--lowering.nodeCount];
+				_pushNode(&lowering, operand == INVALID_DAG_NODE ? INVALID_DAG_NODE : _makeNode(formulaDag, NOT_OPERATION, operand, 0));
+				continue;
+			}
+			const unsigned int right = lowering.nodes[--lowering.nodeCount];
+			const unsigned int left = lowering.nodes[--lowering.nodeCount];
+			if (left == INVALID_DAG_NODE || right == INVALID_DAG_NODE) {
+				_pushNode(&lowering, INVALID_DAG_NODE);
+				continue;
+			}
+			switch (expression->binaryExpression->operatorType) {
+				case BINOP_AND: _pushNode(&lowering, _makeNode(formulaDag, AND_OPERATION, left, right)); break;
+				case BINOP_OR: _pushNode(&lowering, _makeNode(formulaDag, OR_OPERATION, left, right)); break;
+				case BINOP_THEN: _pushNode(&lowering, _makeNode(formulaDag, THEN_OPERATION, left, right)); break;
+				case BINOP_IFF: _pushNode(&lowering, _makeNode(formulaDag, IFF_OPERATION, left, right)); break;
+				default:
+					logError(_logger, "The specified binary operator type is unknown: %d", expression->binaryExpression->operatorType);
+					_pushNode(&lowering, INVALID_DAG_NODE);
+					break;
+			}
+			continue;
+		}
+		++formulaDag->expressionCount;
+		switch (expression->type) {
+			case NOT_EXPRESSION: {
+				const LoweringFrame operand = {.formula = frame->formula, .expression = expression->notExpression->expression, .expanded = false};
+				frame->expanded = true;
+				_pushFrame(&lowering, operand);
+				break;
+			}
+			case BINARY_EXPRESSION: {
+				const LoweringFrame left = {.formula = frame->formula, .expression = expression->binaryExpression->leftExpression, .expanded = false};
+				const LoweringFrame right = {.formula = frame->formula, .expression = expression->binaryExpression->rightExpression, .expanded = false};
+				frame->expanded = true;
+				_pushFrame(&lowering, right);
+				_pushFrame(&lowering, left);
+				break;
+			}
+			case CUSTOM_EXPRESSION: {
+				const CustomExpression * customExpression = expression->customExpression;
+				--lowering.frameCount;
+				if (customExpression->type != PREDEFINED_FORMULA) {
+					_pushNode(&lowering, _lowerApplication(formulaDag, formulaName, customExpression->customOperator));
+					break;
+				}
+				const Symbol * reference = lookupSymbol(formulaDag->symbolTable, FORMULA_SYMBOL, customExpression->predefinedFormula);
+				if (reference == NULL) {
+					logError(_logger, "The formula \"%s\" references the undefined formula \"%s\".",
+						formulaName->name, customExpression->predefinedFormula->name);
+					_pushNode(&lowering, INVALID_DAG_NODE);
+				}
+				else if (formulaDag->formulas[reference->ordinal] == IN_PROGRESS) {
+					logError(_logger, "The formula \"%s\" is circular (through \"%s\").", formulaName->name, reference->name->name);
+					_pushNode(&lowering, INVALID_DAG_NODE);
+				}
+				else if (formulaDag->formulas[reference->ordinal] == UNVISITED) {
+					const LoweringFrame definition = {.formula = reference, .expression = NULL, .expanded = false};
+					_pushFrame(&lowering, definition);
+				}
+				else {
+					_pushNode(&lowering, formulaDag->formulas[reference->ordinal]);
+				}
+				break;
+			}
+			case VARIABLE_EXPRESSION: {
+				const NodeKey load = {.opcode = LOAD_VARIABLE, .left = _variableIndex(formulaDag, expression->variable), .right = 0};
+				--lowering.frameCount;
+				_pushNode(&lowering, _internNode(formulaDag, &load));
+				break;
+			}
+			default:
+				logError(_logger, "The specified expression type is unknown: %d", expression->type);
+				--lowering.frameCount;
+				_pushNode(&lowering, INVALID_DAG_NODE);
+				break;
+		}
+	}
+	free(lowering.frames);
+	free(lowering.nodes);
+}
+
+/**
+ * Lowers the truth table of a custom operator (only once per program): the
+ * rows of each image are the first cover of that image, and the inputs out of
+ * every row (if the table has an "otherwise" entry) are added to the cover of
+ * its image. Then, each cover is minimized against the other one.
+ */
+static const OperatorTable * _lowerOperator(FormulaDag * formulaDag, const Symbol * symbol) {
+	if (formulaDag->operators[symbol->ordinal] != NULL) {
+		return formulaDag->operators[symbol->ordinal];
+	}
+	const DefineOperator * defineOperator = symbol->definition;
+	OperatorTable * operator = allocateInArena(formulaDag->arena, 1, sizeof(OperatorTable));
+	operator->name = defineOperator->customOperator->name;
+	operator->arity = defineOperator->customOperator->variableList->count;
+	operator->trueCover = createCubeCover();
+	operator->falseCover = createCubeCover();
+	operator->bitmask = defineOperator->bitmask;
+	CubeCover * rows = createCubeCover();
+	const TruthTableEntry * otherwise = NULL;
+	const TruthTable * table = defineOperator->truthTable;
+	for (unsigned int k = 0; k < table->count; ++k) {
+		const TruthTableEntry * entry = table->entries[k];
+		if (entry->type == OTHERWISE_ENTRY) {
+			otherwise = entry;
+			continue;
+		}
+		const Cube cube = truthTableRowCube(entry);
+		addCube(entry->mapValue->value ? operator->trueCover : operator->falseCover, cube);
+		addCube(rows, cube);
+	}
+	if (otherwise != NULL) {
+		const Cube everyInput = {.care = 0, .values = 0};
+		CubeCover * remainder = complementCover(rows, everyInput);
+		CubeCover * cover = otherwise->otherwiseValue->value ? operator->trueCover : operator->falseCover;
+		for (unsigned int k = 0; k < remainder->count; ++k) {
+			addCube(cover, remainder->cubes[k]);
+		}
+		destroyCubeCover(remainder);
+	}
+	destroyCubeCover(rows);
+	minimizeCover(operator->trueCover, operator->falseCover);
+	minimizeCover(operator->falseCover, operator->trueCover);
+	logDebugging(_logger, "The operator \"%s\" takes %u cubes of true, and %u cubes of false.",
+		operator->name->name, operator->trueCover->count, operator->falseCover->count);
+	formulaDag->operators[symbol->ordinal] = operator;
+	return operator;
+}
+
+/**
+ * Returns the node of a built-in connective. The operands of the commutative
+ * ones are ordered by index. A double negation stays as 2 nodes, because the
+ * attributes of a formula count the connectives as they were written.
+ */
+static unsigned int _makeNode(FormulaDag * formulaDag, const Opcode opcode, const unsigned int left, const unsigned int right) {
+	const boolean commutative = opcode == AND_OPERATION || opcode == OR_OPERATION || opcode == IFF_OPERATION;
+	const NodeKey key = {
+		.opcode = opcode,
+		.left = commutative && right < left ? right : left,
+		.right = commutative && right < left ? left : right
+	};
+	return _internNode(formulaDag, &key);
+}
+
+/**
+ * The encoded operands of a node of the DAG.
+ */
+static NodeKey _nodeKey(const FormulaDag * formulaDag, const unsigned int node) {
+	const Opcode opcode = formulaDag->opcodes[node];
+	return (NodeKey) {
+		.opcode = opcode,
+		.left = formulaDag->lefts[node],
+		.right = formulaDag->rights[node],
+		.arguments = opcode == CUSTOM_OPERATION ? &formulaDag->arguments[formulaDag->rights[node]] : NULL
+	};
+}
+
+/**
+ * Pushes an expression to lower.
+ */
+static void _pushFrame(Lowering * lowering, const LoweringFrame frame) {
+	if (lowering->frameCount == lowering->frameCapacity) {
+		lowering->frameCapacity = lowering->frameCapacity == 0 ? 64 : 2 * lowering->frameCapacity;
+		lowering->frames = realloc(lowering->frames, lowering->frameCapacity * sizeof(LoweringFrame));
+	}
+	lowering->frames[lowering->frameCount++] = frame;
+}
+
+/**
+ * Pushes the node of a lowered expression.
+ */
+static void _pushNode(Lowering * lowering, const unsigned int node) {
+	if (lowering->nodeCount == lowering->nodeCapacity) {
+		lowering->nodeCapacity = lowering->nodeCapacity == 0 ? 64 : 2 * lowering->nodeCapacity;
+		lowering->nodes = realloc(lowering->nodes, lowering->nodeCapacity * sizeof(unsigned int));
+	}
+	lowering->nodes[lowering->nodeCount++] = node;
+}
+
+/**
+ * The index of a variable in the DAG, assigning the next one the first time
+ * the variable occurs.
+ */
+static unsigned int _variableIndex(FormulaDag * formulaDag, const Identifier * variable) {
+	if (formulaDag->variableIndexes[variable->id] == UINT_MAX) {
+		if (formulaDag->variableCount == formulaDag->variableCapacity) {
+			formulaDag->variableCapacity = formulaDag->variableCapacity == 0 ? 16 : 2 * formulaDag->variableCapacity;
+			formulaDag->variables = realloc(formulaDag->variables, formulaDag->variableCapacity * sizeof(Identifier *));
+		}
+		formulaDag->variableIndexes[variable->id] = formulaDag->variableCount;
+		formulaDag->variables[formulaDag->variableCount++] = variable;
+	}
+	return formulaDag->variableIndexes[variable->id];
+}
+
+/* PUBLIC FUNCTIONS */
+
+FormulaDag * createFormulaDag(const SymbolTable * symbolTable) {
+	FormulaDag * formulaDag = calloc(1, sizeof(FormulaDag));
+	formulaDag->symbolTable = symbolTable;
+	formulaDag->arena = createArena(DEFAULT_ARENA_BLOCK_SIZE);
+	_growTables(formulaDag);
+	return formulaDag;
+}
+
+void destroyFormulaDag(FormulaDag * formulaDag) {
+	if (formulaDag != NULL) {
+		logDebugging(_logger, "The DAG takes %u nodes for %llu lowered expressions.",
+			formulaDag->nodeCount, (unsigned long long) formulaDag->expressionCount);
+		for (unsigned int k = 0; k < formulaDag->operatorCount; ++k) {
+			if (formulaDag->operators[k] != NULL) {
+				destroyCubeCover(formulaDag->operators[k]->trueCover);
+				destroyCubeCover(formulaDag->operators[k]->falseCover);
+			}
+		}
+		for (unsigned int k = 0; k < formulaDag->attributeCount; ++k) {
+			if (formulaDag->attributes[k] != NULL) {
+				destroyNatural(formulaDag->attributes[k]->complexity);
+				destroyNatural(formulaDag->attributes[k]->binaryComplexity);
+			}
+		}
+		destroyArena(formulaDag->arena);
+		free(formulaDag->attributes);
+		free(formulaDag->variables);
+		free(formulaDag->variableIndexes);
+		free(formulaDag->opcodes);
+		free(formulaDag->lefts);
+		free(formulaDag->rights);
+		free(formulaDag->arguments);
+		free(formulaDag->buckets);
+		free(formulaDag->formulas);
+		free(formulaDag->operators);
+		free(formulaDag);
+	}
+}
+
+unsigned int dagFormula(FormulaDag * formulaDag, const Identifier * formulaName) {
+	const Symbol * symbol = lookupSymbol(formulaDag->symbolTable, FORMULA_SYMBOL, formulaName);
+	if (symbol == NULL) {
+		return INVALID_DAG_NODE;
+	}
+	_growTables(formulaDag);
+	if (formulaDag->formulas[symbol->ordinal] == UNVISITED) {
+		_lowerFormula(formulaDag, symbol);
+	}
+	return formulaDag->formulas[symbol->ordinal];
+}
+
+const OperatorTable * dagOperator(FormulaDag * formulaDag, const Identifier * operatorName) {
+	const Symbol * symbol = lookupSymbol(formulaDag->symbolTable, OPERATOR_SYMBOL, operatorName);
+	if (symbol == NULL) {
+		return NULL;
+	}
+	_growTables(formulaDag);
+	return _lowerOperator(formulaDag, symbol);
+}
+
+const DagAttributes * dagAttributes(FormulaDag * formulaDag, const unsigned int node) {
+	if (formulaDag->attributeCount < formulaDag->nodeCount) {
+		formulaDag->attributes = realloc(formulaDag->attributes, formulaDag->nodeCount * sizeof(DagAttributes *));
+		memset(&formulaDag->attributes[formulaDag->attributeCount], 0,
+			(formulaDag->nodeCount - formulaDag->attributeCount) * sizeof(DagAttributes *));
+		formulaDag->attributeCount = formulaDag->nodeCount;
+	}
+	if (formulaDag->attributes[node] != NULL) {
+		return formulaDag->attributes[node];
+	}
+	// A node stays on the stack until its operands have attributes, and then
+	// it's analyzed (a node reached from several ones may be pushed more than
+	// once, but it's analyzed only the first time it's popped).
+	unsigned int * stack = malloc(64 * sizeof(unsigned int));
+	unsigned int capacity = 64;
+	unsigned int size = 0;
+	stack[size++] = node;
+	while (0 < size) {
+		const unsigned int top = stack[size - 1];
+		if (formulaDag->attributes[top] != NULL) {
+			--size;
+			continue;
+		}
+		const DagNode current = dagNode(formulaDag, top);
+		const unsigned int operandCount = dagOperandCount(&current);
+		const unsigned int previousSize = size;
+		for (unsigned int k = operandCount; 0 < k; --k) {
+			const unsigned int operand = dagOperand(&current, k - 1);
+			if (formulaDag->attributes[operand] == NULL) {
+				if (size == capacity) {
+					capacity *= 2;
+					stack = realloc(stack, capacity * sizeof(unsigned int));
+				}
+				stack[size++] = operand;
+			}
+		}
+		if (size == previousSize) {
+			_analyzeNode(formulaDag, top);
+			--size;
+		}
+	}
+	free(stack);
+	return formulaDag->attributes[node];
+}
+
+boolean dagSupports(const FormulaDag * formulaDag, const DagAttributes * attributes, const Identifier * variable) {
+	if (formulaDag->identifierCapacity <= variable->id) {
+		return false;
+	}
+	const unsigned int index = formulaDag->variableIndexes[variable->id];
+	return index / 64 < attributes->supportWords && ((attributes->support[index / 64] >> (index % 64)) & 1);
+}
+
+const Identifier * dagVariable(const FormulaDag * formulaDag, const unsigned int index) {
+	return formulaDag->variables[index];
+}
+
+unsigned int dagVariableIndex(const FormulaDag * formulaDag, const Identifier * variable) {
+	return variable->id < formulaDag->identifierCapacity ? formulaDag->variableIndexes[variable->id] : UINT_MAX;
+}
+
+unsigned int dagVariableCount(const FormulaDag * formulaDag) {
+	return formulaDag->variableCount;
+}
+
+DagNode dagNode(const FormulaDag * formulaDag, const unsigned int node) {
+	const Opcode opcode = formulaDag->opcodes[node];
+	DagNode dagNode = {
+		.opcode = opcode,
+		.left = formulaDag->lefts[node],
+		.right = formulaDag->rights[node],
+		.variable = NULL,
+		.operator = NULL,
+		.arguments = NULL
+	};
+	if (opcode == LOAD_VARIABLE) {
+		dagNode.variable = formulaDag->variables[dagNode.left];
+	}
+	else if (opcode == CUSTOM_OPERATION) {
+		dagNode.operator = formulaDag->operators[dagNode.left];
+		dagNode.arguments = &formulaDag->arguments[dagNode.right];
+	}
+	return dagNode;
+}
+
+unsigned int dagOperand(const DagNode * node, const unsigned int k) {
+	if (node->opcode == CUSTOM_OPERATION) {
+		return node->arguments[k];
+	}
+	return k == 0 ? node->left : node->right;
+}
+
+unsigned int dagOperandCount(const DagNode * node) {
+	switch (node->opcode) {
+		case LOAD_VARIABLE: return 0;
+		case NOT_OPERATION: return 1;
+		case CUSTOM_OPERATION: return node->operator->arity;
+		default: return 2;
+	}
+}
+
+unsigned int dagNodeCount(const FormulaDag * formulaDag) {
+	return formulaDag->nodeCount;
+}
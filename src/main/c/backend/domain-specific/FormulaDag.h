@@ -0,0 +1,189 @@
+#ifndef FORMULA_DAG_HEADER
+#define FORMULA_DAG_HEADER
+
+#include "../../frontend/semantic-analysis/SemanticAnalyzer.h"
+#include "../../frontend/syntactic-analysis/AbstractSyntaxTree.h"
+#include "../../shared/Arena.h"
+#include "../../shared/CubeCover.h"
+#include "../../shared/Identifier.h"
+#include "../../shared/Logger.h"
+#include "../../shared/Natural.h"
+#include "../../shared/SymbolTable.h"
+#include "../../shared/Type.h"
+#include "CubeMinimizer.h"
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Initialize module's internal state. */
+void initializeFormulaDagModule();
+
+/** Shutdown module's internal state. */
+void shutdownFormulaDagModule();
+
+/**
+ * The node returned for a formula that cannot be lowered.
+ */
+#define INVALID_DAG_NODE UINT_MAX
+
+/**
+ * The kinds of nodes of the DAG, which are also the instructions of a
+ * compiled formula.
+ */
+typedef enum {
+	LOAD_VARIABLE,
+	NOT_OPERATION,
+	AND_OPERATION,
+	OR_OPERATION,
+	THEN_OPERATION,
+	IFF_OPERATION,
+	CUSTOM_OPERATION
+} Opcode;
+
+/**
+ * The truth table of a custom operator, as 2 minimized sums of products: the
+ * cover of the inputs whose image is true, and the one of the inputs whose
+ * image is false (so both covers partition the inputs). The bit "k" of a cube
+ * is the argument "k" of the truth-value lists of the AST, which is the same
+ * order of the argument lists of its applications. The operators of small
+ * arity also keep their dense table, from the semantic analysis.
+ */
+typedef struct {
+	// The name identifies the operator (there is a single table per operator).
+	const Identifier * name;
+	unsigned int arity;
+
+	CubeCover * trueCover;
+	CubeCover * falseCover;
+
+	// The dense table (only up to MAX_DENSE_ARITY, or NULL): the bit "v" is
+	// the image of the input where the argument "k" is the bit "k" of "v".
+	const uint64_t * bitmask;
+} OperatorTable;
+
+/**
+ * A node of the DAG, decoded from its arrays. Its operands are nodes with
+ * smaller indexes, so the nodes are always in topological order.
+ */
+typedef struct {
+	Opcode opcode;
+
+	// The nodes of the operands (the right one is unused by the
+	// NOT_OPERATION). The left one of a LOAD_VARIABLE is the index of its
+	// variable.
+	unsigned int left;
+	unsigned int right;
+
+	// Only for the LOAD_VARIABLE node.
+	const Identifier * variable;
+
+	// Only for the CUSTOM_OPERATION node: the operator, and the nodes of its
+	// arguments.
+	const OperatorTable * operator;
+	const uint32_t * arguments;
+} DagNode;
+
+/**
+ * The attributes of a node of the DAG, as a formula: its complexity (the
+ * amount of connectives), its binary complexity (the amount of connectives
+ * with 2 operands), its depth (the longest chain of nested connectives), and
+ * its support (the variables that occur in it). The complexities count every
+ * occurrence of a shared subformula, so they can overflow 64 bits, and they
+ * measure the formula as it was written (a double negation counts twice).
+ */
+typedef struct {
+	Natural * complexity;
+	Natural * binaryComplexity;
+	unsigned int depth;
+
+	// A bitset by index of variable of the DAG (only as many words as the
+	// highest index needs), and the amount of variables in it.
+	const uint64_t * support;
+	unsigned int supportWords;
+	unsigned int supportSize;
+} DagAttributes;
+
+/**
+ * Every formula of a program, lowered into a single hash-consed DAG: the
+ * structurally identical subformulas (in one formula or in several ones) are
+ * the same node, and a reference to a predefined formula is the root of that
+ * formula, not a copy of it. The operands of the commutative connectives are
+ * ordered, so "p & q" and "q & p" are the same node too. Hence, the size of
+ * the DAG is the amount of unique subformulas, even if the references nest
+ * exponentially large expansions.
+ *
+ * The DAG is the intermediate representation of the backend: its nodes are
+ * flat arrays (an opcode byte, and 2 operands of 32 bits each), so every
+ * engine compiles a formula from it without reading the AST, and the
+ * expressions of the AST can be released once every formula is lowered.
+ */
+typedef struct FormulaDag FormulaDag;
+
+/**
+ * Creates an empty DAG for the program of a symbol table.
+ */
+FormulaDag * createFormulaDag(const SymbolTable * symbolTable);
+
+/**
+ * Destroy a DAG, and the truth tables of its operators.
+ */
+void destroyFormulaDag(FormulaDag * formulaDag);
+
+/**
+ * The root of a predefined formula, lowering its definition (and the ones it
+ * references) the first time, so it cannot be called for the first time after
+ * the expressions of the AST are released. Returns INVALID_DAG_NODE if the
+ * formula references undefined formulas or operators, or if it's circular.
+ */
+unsigned int dagFormula(FormulaDag * formulaDag, const Identifier * formulaName);
+
+/**
+ * The truth table of a custom operator, lowering it the first time. Returns
+ * NULL if the operator is undefined.
+ */
+const OperatorTable * dagOperator(FormulaDag * formulaDag, const Identifier * operatorName);
+
+/**
+ * The attributes of a node of the DAG, computed the first time in a single
+ * post-order pass over the nodes below it that don't have attributes yet (so
+ * the subformulas shared by several formulas are only analyzed once).
+ */
+const DagAttributes * dagAttributes(FormulaDag * formulaDag, const unsigned int node);
+
+/**
+ * Returns true if a variable occurs in a node with the specified attributes.
+ */
+boolean dagSupports(const FormulaDag * formulaDag, const DagAttributes * attributes, const Identifier * variable);
+
+/**
+ * The variable with the specified index (the variables of the DAG are indexed
+ * by order of appearance, so the supports are as dense as possible).
+ */
+const Identifier * dagVariable(const FormulaDag * formulaDag, const unsigned int index);
+
+/**
+ * The index of a variable in the DAG (or UINT_MAX, if it occurs in no
+ * formula), and the amount of variables of the DAG.
+ */
+unsigned int dagVariableIndex(const FormulaDag * formulaDag, const Identifier * variable);
+unsigned int dagVariableCount(const FormulaDag * formulaDag);
+
+/**
+ * A node of the DAG, by index (its arguments are valid until the DAG grows).
+ */
+DagNode dagNode(const FormulaDag * formulaDag, const unsigned int node);
+
+/**
+ * The operand "k" of a node (the argument "k", for a custom operation), and
+ * the amount of operands of a node.
+ */
+unsigned int dagOperand(const DagNode * node, const unsigned int k);
+unsigned int dagOperandCount(const DagNode * node);
+
+/**
+ * The amount of nodes of the DAG.
+ */
+unsigned int dagNodeCount(const FormulaDag * formulaDag);
+
+#endif
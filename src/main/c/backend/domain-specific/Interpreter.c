@@ -0,0 +1,681 @@
+#include "Interpreter.h"
+
+/* MODULE INTERNAL STATE */
+
+/**
+ * The engines that answer the semantic queries: the automatic one enumerates
+ * the valuations of the formulas with few variables, and asks the SAT session
+ * about the rest of them.
+ */
+typedef enum {
+	AUTOMATIC_ENGINE,
+	TRUTH_TABLE_ENGINE,
+	SAT_ENGINE,
+	BDD_ENGINE
+} FormulaEngine;
+
+static Logger * _logger = NULL;
+static const char * _cnfDirectory = NULL;
+static const char * _modelsDirectory = NULL;
+static ModelFormat _modelFormat = BINARY_MODEL_FORMAT;
+static FormulaEngine _formulaEngine = AUTOMATIC_ENGINE;
+
+void initializeInterpreterModule() {
+	_logger = createLogger("Interpreter");
+	_cnfDirectory = getStringOrDefault("CNF_DIRECTORY", NULL);
+	_modelsDirectory = getStringOrDefault("MODELS_DIRECTORY", NULL);
+	const char * modelFormat = getStringOrDefault("MODELS_FORMAT", "binary");
+	if (strcmp(modelFormat, "text") == 0) {
+		_modelFormat = TEXT_MODEL_FORMAT;
+	}
+	else if (strcmp(modelFormat, "binary") != 0) {
+		logWarning(_logger, "The models format \"%s\" is unknown (using \"binary\").", modelFormat);
+	}
+	const char * engine = getStringOrDefault("FORMULA_ENGINE", "auto");
+	if (strcmp(engine, "truth-table") == 0) {
+		_formulaEngine = TRUTH_TABLE_ENGINE;
+	}
+	else if (strcmp(engine, "sat") == 0) {
+		_formulaEngine = SAT_ENGINE;
+	}
+	else if (strcmp(engine, "bdd") == 0) {
+		_formulaEngine = BDD_ENGINE;
+	}
+	else if (strcmp(engine, "auto") != 0) {
+		logWarning(_logger, "The formula engine \"%s\" is unknown (using \"auto\").", engine);
+	}
+}
+
+void shutdownInterpreterModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/**
+ * An operator whose clones are not known yet.
+ */
+#define UNCLASSIFIED UINT_MAX
+
+/**
+ * The state of an execution: the DAG of every formula, the compiled formulas,
+ * and the clones of the custom operators, by ordinal, and the SAT and BDD
+ * sessions shared by every query (each one created with its first query). The
+ * tables by ordinal grow with the symbol table, because in streaming mode the
+ * statements are executed while the program is still being parsed.
+ */
+typedef struct {
+	const SymbolTable * symbolTable;
+	FormulaDag * formulaDag;
+	CompiledFormula ** compiledFormulas;
+	unsigned int formulaCount;
+	unsigned int * operatorClasses;
+	unsigned int operatorCount;
+	SatSession * satSession;
+	BddSession * bddSession;
+
+	// The values of the valuation of the current "evaluate", by index of
+	// variable of the DAG (0 if unassigned, or 1 plus the value).
+	uint8_t * assignments;
+	unsigned int assignmentCapacity;
+
+	// In streaming mode, false since the first statement that failed (the
+	// following ones are still analyzed, but not executed).
+	boolean succeed;
+} Execution;
+
+/* PRIVATE FUNCTIONS */
+
+static void _assignValuation(Execution * execution, const ValuationList * valuationList, const boolean clear);
+static BddSession * _bddSession(Execution * execution);
+static boolean _classifyWithSat(Execution * execution, const CompiledFormula * compiledFormula, FormulaClass * formulaClass);
+static const CompiledFormula * _compiledFormula(Execution * execution, const Identifier * formulaName, const char * statementName);
+static boolean _congruentWithSat(Execution * execution, const CompiledFormula * left, const CompiledFormula * right, boolean * congruent);
+static Execution * _createExecution(const SymbolTable * symbolTable);
+static void _destroyExecution(Execution * execution);
+static boolean _executeAdequacy(Execution * execution, const AdequateStatement * adequateStatement);
+static boolean _executeAnalysis(Execution * execution, const FormulaAnalysisStatement * formulaAnalysisStatement);
+static boolean _executeCongruence(Execution * execution, const CongruenceStatement * congruenceStatement);
+static boolean _executeEvaluation(Execution * execution, const EvaluateStatement * evaluateStatement);
+static boolean _executeStatement(Execution * execution, const Statement * statement);
+static boolean _exportCnf(const CompiledFormula * compiledFormula);
+static boolean _exportModels(Execution * execution, const CompiledFormula * compiledFormula);
+static void _generateModel(const CompiledFormula * compiledFormula, const uint64_t valuation, void * context);
+static void _growTables(Execution * execution);
+static SatSession * _satSession(Execution * execution);
+static void _streamStatement(CompilerState * compilerState, void * statement, void * context);
+static void _writeClause(const Literal * literals, const unsigned int count, void * context);
+static void _writeModel(const CompiledFormula * compiledFormula, const uint64_t valuation, void * context);
+
+/**
+ * Assigns the values of a valuation to the variables of the DAG, by index (or
+ * clears them). The variables that occur in no formula are ignored.
+ */
+static void _assignValuation(Execution * execution, const ValuationList * valuationList, const boolean clear) {
+	const unsigned int variableCount = dagVariableCount(execution->formulaDag);
+	if (execution->assignmentCapacity < variableCount) {
+		free(execution->assignments);
+		execution->assignmentCapacity = 2 * variableCount;
+		execution->assignments = calloc(execution->assignmentCapacity, sizeof(uint8_t));
+	}
+	for (unsigned int k = 0; k < valuationList->count; ++k) {
+		const Valuation * valuation = valuationList->valuations[k];
+		const unsigned int index = dagVariableIndex(execution->formulaDag, valuation->variable);
+		if (index < variableCount) {
+			execution->assignments[index] = clear ? 0 : 1 + valuation->truthValue->value;
+		}
+	}
+}
+
+/**
+ * Returns the BDD session of the execution, creating it with the first query.
+ */
+static BddSession * _bddSession(Execution * execution) {
+	if (execution->bddSession == NULL) {
+		execution->bddSession = createBddSession(execution->symbolTable, execution->formulaDag);
+	}
+	return execution->bddSession;
+}
+
+/**
+ * Classifies a formula with 2 satisfiability queries to the session: one
+ * assuming the root, and one assuming its negation.
+ */
+static boolean _classifyWithSat(Execution * execution, const CompiledFormula * compiledFormula, FormulaClass * formulaClass) {
+	SatSession * satSession = _satSession(execution);
+	const Literal root = sessionFormula(satSession, compiledFormula);
+	if (root == 0) {
+		return false;
+	}
+	const Literal negatedRoot = -root;
+	const boolean satisfiable = solveSession(satSession, &root, 1) == SATISFIABLE;
+	const boolean falsifiable = solveSession(satSession, &negatedRoot, 1) == SATISFIABLE;
+	if (satisfiable && falsifiable) {
+		*formulaClass = CONTINGENCY;
+	}
+	else {
+		*formulaClass = satisfiable ? TAUTOLOGY : CONTRADICTION;
+	}
+	return true;
+}
+
+/**
+ * Returns the compiled formula with the specified name, compiling it the
+ * first time. Returns NULL if the formula cannot be compiled.
+ */
+static const CompiledFormula * _compiledFormula(Execution * execution, const Identifier * formulaName, const char * statementName) {
+	const Symbol * symbol = lookupSymbol(execution->symbolTable, FORMULA_SYMBOL, formulaName);
+	CompiledFormula ** compiledFormula = &execution->compiledFormulas[symbol->ordinal];
+	if (*compiledFormula == NULL) {
+		*compiledFormula = compileFormula(execution->symbolTable, execution->formulaDag, formulaName);
+		if (*compiledFormula == NULL) {
+			logError(_logger, "The formula \"%s\" cannot be compiled (in \"%s\").", formulaName->name, statementName);
+		}
+	}
+	return *compiledFormula;
+}
+
+/**
+ * Decides if 2 formulas are congruent with the SAT session: both formulas are
+ * loaded into it (so they share every common subformula), and the session
+ * looks for a valuation that falsifies the equivalence of their roots (i.e.,
+ * the miter of the formulas). If there's one, it's the model of the session.
+ */
+static boolean _congruentWithSat(Execution * execution, const CompiledFormula * left, const CompiledFormula * right, boolean * congruent) {
+	SatSession * satSession = _satSession(execution);
+	const Literal leftRoot = sessionFormula(satSession, left);
+	const Literal rightRoot = sessionFormula(satSession, right);
+	if (leftRoot == 0 || rightRoot == 0) {
+		return false;
+	}
+	*congruent = true;
+	if (leftRoot != rightRoot) {
+		const Literal miter = -sessionConnective(satSession, IFF_OPERATION, leftRoot, rightRoot);
+		*congruent = solveSession(satSession, &miter, 1) == UNSATISFIABLE;
+	}
+	else {
+		logDebugging(_logger, "The formulas \"%s\" and \"%s\" are structurally equal.", left->name->name, right->name->name);
+	}
+	return true;
+}
+
+/**
+ * Creates an execution with empty tables, which grow with the symbol table.
+ */
+static Execution * _createExecution(const SymbolTable * symbolTable) {
+	Execution * execution = calloc(1, sizeof(Execution));
+	execution->symbolTable = symbolTable;
+	execution->formulaDag = createFormulaDag(symbolTable);
+	execution->succeed = true;
+	_growTables(execution);
+	return execution;
+}
+
+/**
+ * Destroys an execution, with its compiled formulas and sessions.
+ */
+static void _destroyExecution(Execution * execution) {
+	for (unsigned int k = 0; k < execution->formulaCount; ++k) {
+		destroyCompiledFormula(execution->compiledFormulas[k]);
+	}
+	free(execution->compiledFormulas);
+	free(execution->operatorClasses);
+	free(execution->assignments);
+	destroySatSession(execution->satSession);
+	destroyBddSession(execution->bddSession);
+	destroyFormulaDag(execution->formulaDag);
+	free(execution);
+}
+
+/**
+ * Executes a "classify", "models", "cnf", "count" or "complexity" statement.
+ * The complexity comes from the attributes of the DAG, so that formula is
+ * never compiled.
+ */
+static boolean _executeAnalysis(Execution * execution, const FormulaAnalysisStatement * formulaAnalysisStatement) {
+	const char * statementName = formulaAnalysisName(formulaAnalysisStatement->type);
+	if (lookupSymbol(execution->symbolTable, FORMULA_SYMBOL, formulaAnalysisStatement->formulaName) == NULL) {
+		logWarning(_logger, "Skipping \"%s\" of the undefined formula \"%s\".", statementName, formulaAnalysisStatement->formulaName->name);
+		return true;
+	}
+	if (formulaAnalysisStatement->type == COMPLEXITY_ANALYSIS) {
+		const unsigned int root = dagFormula(execution->formulaDag, formulaAnalysisStatement->formulaName);
+		if (root == INVALID_DAG_NODE) {
+			logError(_logger, "The formula \"%s\" cannot be compiled (in \"%s\").", formulaAnalysisStatement->formulaName->name, statementName);
+			return false;
+		}
+		generateComplexity(formulaAnalysisStatement->formulaName, dagAttributes(execution->formulaDag, root));
+		return true;
+	}
+	const CompiledFormula * compiledFormula = _compiledFormula(execution, formulaAnalysisStatement->formulaName, statementName);
+	if (compiledFormula == NULL) {
+		return false;
+	}
+	switch (formulaAnalysisStatement->type) {
+		case CLASSIFY_ANALYSIS: {
+			FormulaClass formulaClass = CONTINGENCY;
+			if (_formulaEngine == BDD_ENGINE) {
+				const BddEdge root = bddSessionFormula(_bddSession(execution), compiledFormula);
+				if (root == BDD_TRUE || root == BDD_FALSE) {
+					formulaClass = root == BDD_TRUE ? TAUTOLOGY : CONTRADICTION;
+				}
+			}
+			else if (_formulaEngine == SAT_ENGINE
+				|| (_formulaEngine == AUTOMATIC_ENGINE && SAT_CLASSIFICATION_THRESHOLD < compiledFormula->variableCount)) {
+				if (!_classifyWithSat(execution, compiledFormula, &formulaClass)) {
+					return false;
+				}
+			}
+			else if (MAX_TRUTH_TABLE_VARIABLES < compiledFormula->variableCount) {
+				logError(_logger, "The formula \"%s\" has %u variables, but truth tables support up to %u.",
+					compiledFormula->name->name, compiledFormula->variableCount, MAX_TRUTH_TABLE_VARIABLES);
+				return false;
+			}
+			else {
+				formulaClass = classifyFormula(compiledFormula);
+			}
+			generateClassification(compiledFormula->name, formulaClass);
+			return true;
+		}
+		case MODELS_ANALYSIS: {
+			if (MAX_TRUTH_TABLE_VARIABLES < compiledFormula->variableCount) {
+				logError(_logger, "The formula \"%s\" has %u variables, but \"%s\" supports up to %u.",
+					compiledFormula->name->name, compiledFormula->variableCount, statementName, MAX_TRUTH_TABLE_VARIABLES);
+				return false;
+			}
+			if (_modelsDirectory != NULL) {
+				return _exportModels(execution, compiledFormula);
+			}
+			generateModelsHeader(compiledFormula);
+			const uint64_t models = _formulaEngine == BDD_ENGINE
+				? enumerateBddModels(_bddSession(execution), compiledFormula, _generateModel, NULL)
+				: enumerateModels(compiledFormula, _generateModel, NULL);
+			generateModelsFooter(models);
+			return true;
+		}
+		case CNF_ANALYSIS:
+			return _exportCnf(compiledFormula);
+		case COUNT_ANALYSIS: {
+			Natural * models = createNatural(0);
+			if (_formulaEngine == BDD_ENGINE) {
+				countBddModels(_bddSession(execution), compiledFormula, models);
+			}
+			else if (_formulaEngine == TRUTH_TABLE_ENGINE
+				|| (_formulaEngine == AUTOMATIC_ENGINE && compiledFormula->variableCount <= COUNT_ENUMERATION_THRESHOLD)) {
+				if (MAX_TRUTH_TABLE_VARIABLES < compiledFormula->variableCount) {
+					logError(_logger, "The formula \"%s\" has %u variables, but truth tables support up to %u.",
+						compiledFormula->name->name, compiledFormula->variableCount, MAX_TRUTH_TABLE_VARIABLES);
+					destroyNatural(models);
+					return false;
+				}
+				setNatural(models, enumerateModels(compiledFormula, NULL, NULL));
+			}
+			else if (!countFormulaModels(compiledFormula, models)) {
+				destroyNatural(models);
+				return false;
+			}
+			generateCount(compiledFormula->name, models);
+			destroyNatural(models);
+			return true;
+		}
+		default:
+			logError(_logger, "The specified formula analysis type is unknown: %d", formulaAnalysisStatement->type);
+			return false;
+	}
+}
+
+/**
+ * Executes an "adequate" statement, with the criterion of Post: the opset is
+ * adequate if, and only if, no clone holds every operator. The clones of a
+ * custom operator are computed once per execution, and shared by every opset.
+ */
+static boolean _executeAdequacy(Execution * execution, const AdequateStatement * adequateStatement) {
+	const Symbol * opset = lookupSymbol(execution->symbolTable, OPSET_SYMBOL, adequateStatement->opsetName);
+	if (opset == NULL) {
+		logWarning(_logger, "Skipping \"adequate\" of the undefined opset \"%s\".", adequateStatement->opsetName->name);
+		return true;
+	}
+	const DefineOpset * defineOpset = opset->definition;
+	unsigned int commonClasses = ALL_POST_CLASSES;
+	const OpsetList * opsetList = defineOpset->opsetList;
+	for (unsigned int k = 0; k < opsetList->count; ++k) {
+		unsigned int postClasses = 0;
+		if (!builtInPostClasses(opsetList->operators[k], &postClasses)) {
+			const Symbol * symbol = lookupSymbol(execution->symbolTable, OPERATOR_SYMBOL, opsetList->operators[k]);
+			if (symbol == NULL) {
+				logWarning(_logger, "Skipping \"adequate\" of the opset \"%s\", with the undefined operator \"%s\".",
+					defineOpset->name->name, opsetList->operators[k]->name);
+				return true;
+			}
+			unsigned int * cachedClasses = &execution->operatorClasses[symbol->ordinal];
+			if (*cachedClasses == UNCLASSIFIED) {
+				*cachedClasses = operatorPostClasses(dagOperator(execution->formulaDag, symbol->name));
+			}
+			postClasses = *cachedClasses;
+		}
+		commonClasses &= postClasses;
+	}
+	generateAdequacy(defineOpset->name, commonClasses);
+	return true;
+}
+
+/**
+ * Executes a "congruent" statement with the SAT session or, with the BDD
+ * engine, comparing the BDDs of both formulas (which are canonical). If the
+ * formulas are not congruent, the counterexample is a model of the negation
+ * of their equivalence.
+ */
+static boolean _executeCongruence(Execution * execution, const CongruenceStatement * congruenceStatement) {
+	const Identifier * leftName = congruenceStatement->leftFormulaName;
+	const Identifier * rightName = congruenceStatement->rightFormulaName;
+	if (lookupSymbol(execution->symbolTable, FORMULA_SYMBOL, leftName) == NULL
+		|| lookupSymbol(execution->symbolTable, FORMULA_SYMBOL, rightName) == NULL) {
+		logWarning(_logger, "Skipping \"congruent\" of the undefined formula \"%s\" or \"%s\".", leftName->name, rightName->name);
+		return true;
+	}
+	const CompiledFormula * left = _compiledFormula(execution, leftName, "congruent");
+	const CompiledFormula * right = _compiledFormula(execution, rightName, "congruent");
+	if (left == NULL || right == NULL) {
+		return false;
+	}
+	boolean congruent = true;
+	// Only for the BDD engine: the counterexample, by BDD variable.
+	boolean * witness = NULL;
+	if (_formulaEngine == BDD_ENGINE) {
+		BddSession * bddSession = _bddSession(execution);
+		const BddEdge leftRoot = bddSessionFormula(bddSession, left);
+		const BddEdge rightRoot = bddSessionFormula(bddSession, right);
+		congruent = leftRoot == rightRoot;
+		if (!congruent) {
+			witness = bddSessionWitness(bddSession, bddNot(bddSessionConnective(bddSession, IFF_OPERATION, leftRoot, rightRoot)));
+		}
+	}
+	else if (!_congruentWithSat(execution, left, right, &congruent)) {
+		return false;
+	}
+	// The counterexample assigns the variables of both formulas, merged in
+	// order of declaration.
+	const Identifier ** variables = calloc(1 + left->variableCount + right->variableCount, sizeof(Identifier *));
+	boolean * values = calloc(1 + left->variableCount + right->variableCount, sizeof(boolean));
+	unsigned int count = 0;
+	for (unsigned int l = 0, r = 0; !congruent && (l < left->variableCount || r < right->variableCount);) {
+		const Identifier * variable = NULL;
+		if (r == right->variableCount) {
+			variable = left->variables[l++];
+		}
+		else if (l == left->variableCount) {
+			variable = right->variables[r++];
+		}
+		else {
+			const unsigned int leftOrdinal = lookupSymbol(execution->symbolTable, VARIABLE_SYMBOL, left->variables[l])->ordinal;
+			const unsigned int rightOrdinal = lookupSymbol(execution->symbolTable, VARIABLE_SYMBOL, right->variables[r])->ordinal;
+			variable = leftOrdinal <= rightOrdinal ? left->variables[l] : right->variables[r];
+			l += leftOrdinal <= rightOrdinal;
+			r += rightOrdinal <= leftOrdinal;
+		}
+		variables[count] = variable;
+		values[count++] = witness != NULL
+			? witness[bddSessionVariable(execution->bddSession, variable)]
+			: sessionModelValue(execution->satSession, sessionVariable(execution->satSession, variable));
+	}
+	generateCongruence(leftName, rightName, congruent, variables, values, count);
+	free(witness);
+	free(values);
+	free(variables);
+	return true;
+}
+
+/**
+ * Executes an "evaluate" statement. The valuation must assign every variable
+ * of the formula (the extra assignments are ignored), which is checked
+ * against the support of the formula before compiling it. The values of the
+ * valuation are looked up by index of variable, so the statement takes time
+ * linear in the sizes of the valuation and the formula.
+ */
+static boolean _executeEvaluation(Execution * execution, const EvaluateStatement * evaluateStatement) {
+	const Symbol * valuation = lookupSymbol(execution->symbolTable, VALUATION_SYMBOL, evaluateStatement->valuationName);
+	if (valuation == NULL || lookupSymbol(execution->symbolTable, FORMULA_SYMBOL, evaluateStatement->formulaName) == NULL) {
+		logWarning(_logger, "Skipping \"evaluate\" of the undefined formula \"%s\" or valuation \"%s\".",
+			evaluateStatement->formulaName->name, evaluateStatement->valuationName->name);
+		return true;
+	}
+	const DefineValuation * defineValuation = valuation->definition;
+	const unsigned int root = dagFormula(execution->formulaDag, evaluateStatement->formulaName);
+	_assignValuation(execution, defineValuation->valuationList, false);
+	boolean assigned = true;
+	if (root != INVALID_DAG_NODE) {
+		const DagAttributes * attributes = dagAttributes(execution->formulaDag, root);
+		for (unsigned int index = 0; index < 64 * attributes->supportWords; ++index) {
+			if (((attributes->support[index / 64] >> (index % 64)) & 1) != 0 && execution->assignments[index] == 0) {
+				logError(_logger, "The valuation \"%s\" does not assign the variable \"%s\" of the formula \"%s\".",
+					defineValuation->name->name, dagVariable(execution->formulaDag, index)->name, evaluateStatement->formulaName->name);
+				assigned = false;
+			}
+		}
+	}
+	const CompiledFormula * compiledFormula = assigned
+		? _compiledFormula(execution, evaluateStatement->formulaName, "evaluate")
+		: NULL;
+	if (compiledFormula != NULL) {
+		boolean * values = calloc(1 + compiledFormula->variableCount, sizeof(boolean));
+		for (unsigned int column = 0; column < compiledFormula->variableCount; ++column) {
+			const unsigned int index = dagVariableIndex(execution->formulaDag, compiledFormula->variables[column]);
+			values[column] = execution->assignments[index] == 2;
+		}
+		generateEvaluation(compiledFormula->name, defineValuation->name, evaluateFormula(compiledFormula, values));
+		free(values);
+	}
+	_assignValuation(execution, defineValuation->valuationList, true);
+	return compiledFormula != NULL;
+}
+
+/**
+ * Executes a statement. The definitions were already collected by the
+ * semantic-analysis phase, so they have no effect here, but the formulas are
+ * lowered into the DAG (which releases nothing in batch mode, where they were
+ * lowered before the first statement).
+ */
+static boolean _executeStatement(Execution * execution, const Statement * statement) {
+	_growTables(execution);
+	switch (statement->type) {
+		case DEFINE_FORMULA:
+			dagFormula(execution->formulaDag, statement->defineFormula->name);
+			return true;
+		case DEFINE_VARIABLE:
+		case DEFINE_VALUATION:
+		case DEFINE_OPERATOR:
+		case DEFINE_OPSET:
+			return true;
+		case EVALUATE_STATEMENT:
+			return _executeEvaluation(execution, statement->evaluateStatement);
+		case ADEQUATE_STATEMENT:
+			return _executeAdequacy(execution, statement->adequateStatement);
+		case FORMULA_ANALYSIS_STATEMENT:
+			return _executeAnalysis(execution, statement->formulaAnalysisStatement);
+		case CONGRUENCE_STATEMENT:
+			return _executeCongruence(execution, statement->congruenceStatement);
+		default:
+			logError(_logger, "The specified statement type is unknown: %d", statement->type);
+			return false;
+	}
+}
+
+/**
+ * Exports the CNF of a formula (with its root asserted) in the DIMACS format,
+ * inside the output or to the file "<formula>.cnf" of the CNF directory (if
+ * it's defined). The formula is encoded twice, first to count the clauses of
+ * the problem line, and then to write them as they are produced, so no
+ * clause is ever kept in memory.
+ */
+static boolean _exportCnf(const CompiledFormula * compiledFormula) {
+	CnfHeader cnfHeader;
+	if (!streamFormula(compiledFormula, POSITIVE_POLARITY, NULL, NULL, &cnfHeader)) {
+		return false;
+	}
+	char * path = NULL;
+	FILE * file = stdout;
+	if (_cnfDirectory != NULL) {
+		path = concatenate(4, _cnfDirectory, "/", compiledFormula->name->name, ".cnf");
+		file = fopen(path, "w");
+		if (file == NULL) {
+			logError(_logger, "Cannot open the file \"%s\" to write the CNF of \"%s\".", path, compiledFormula->name->name);
+			free(path);
+			return false;
+		}
+	}
+	generateCnfHeader(compiledFormula, &cnfHeader, path);
+	DimacsWriter * dimacsWriter = createDimacsWriter(file);
+	writeDimacsComment(dimacsWriter, "formula %s", compiledFormula->name->name);
+	for (unsigned int column = 0; column < compiledFormula->variableCount; ++column) {
+		writeDimacsComment(dimacsWriter, "variable %u %s", column + 1, compiledFormula->variables[column]->name);
+	}
+	writeDimacsProblem(dimacsWriter, cnfHeader.variableCount, 1 + cnfHeader.clauseCount);
+	streamFormula(compiledFormula, POSITIVE_POLARITY, _writeClause, dimacsWriter, &cnfHeader);
+	writeDimacsClause(dimacsWriter, &cnfHeader.root, 1);
+	boolean succeed = destroyDimacsWriter(dimacsWriter);
+	if (file != stdout && fclose(file) != 0) {
+		logError(_logger, "Cannot close the file \"%s\".", path);
+		succeed = false;
+	}
+	generateCnfFooter(path);
+	free(path);
+	return succeed;
+}
+
+/**
+ * Writes the models of a formula to the file "<formula>.models" (or
+ * "<formula>.txt", in the text format) of the models directory, as they are
+ * enumerated, so the memory doesn't grow with the amount of models.
+ */
+static boolean _exportModels(Execution * execution, const CompiledFormula * compiledFormula) {
+	char * path = concatenate(4, _modelsDirectory, "/", compiledFormula->name->name, _modelFormat == TEXT_MODEL_FORMAT ? ".txt" : ".models");
+	FILE * file = fopen(path, "wb");
+	if (file == NULL) {
+		logError(_logger, "Cannot open the file \"%s\" to write the models of \"%s\".", path, compiledFormula->name->name);
+		free(path);
+		return false;
+	}
+	ModelWriter * modelWriter = createModelWriter(file, _modelFormat, compiledFormula);
+	const uint64_t models = _formulaEngine == BDD_ENGINE
+		? enumerateBddModels(_bddSession(execution), compiledFormula, _writeModel, modelWriter)
+		: enumerateModels(compiledFormula, _writeModel, modelWriter);
+	boolean succeed = destroyModelWriter(modelWriter);
+	if (fclose(file) != 0) {
+		logError(_logger, "Cannot close the file \"%s\".", path);
+		succeed = false;
+	}
+	generateModelsFile(compiledFormula, models, path);
+	free(path);
+	return succeed;
+}
+
+/**
+ * Generates a model, as soon as it's found.
+ */
+static void _generateModel(const CompiledFormula * compiledFormula, const uint64_t valuation, void * context) {
+	generateModel(compiledFormula, valuation);
+}
+
+/**
+ * Grows the compiled formulas and the clones of the operators, by ordinal, to
+ * cover the symbols defined since the last call.
+ */
+static void _growTables(Execution * execution) {
+	const unsigned int formulaCount = symbolCount(execution->symbolTable, FORMULA_SYMBOL);
+	if (execution->compiledFormulas == NULL || execution->formulaCount < formulaCount) {
+		execution->compiledFormulas = realloc(execution->compiledFormulas, (1 + formulaCount) * sizeof(CompiledFormula *));
+		memset(&execution->compiledFormulas[execution->formulaCount], 0,
+			(1 + formulaCount - execution->formulaCount) * sizeof(CompiledFormula *));
+		execution->formulaCount = formulaCount;
+	}
+	const unsigned int operatorCount = symbolCount(execution->symbolTable, OPERATOR_SYMBOL);
+	if (execution->operatorClasses == NULL || execution->operatorCount < operatorCount) {
+		execution->operatorClasses = realloc(execution->operatorClasses, (1 + operatorCount) * sizeof(unsigned int));
+		for (unsigned int k = execution->operatorCount; k < operatorCount; ++k) {
+			execution->operatorClasses[k] = UNCLASSIFIED;
+		}
+		execution->operatorCount = operatorCount;
+	}
+}
+
+/**
+ * Returns the SAT session of the execution, creating it with the first query.
+ */
+static SatSession * _satSession(Execution * execution) {
+	if (execution->satSession == NULL) {
+		execution->satSession = createSatSession(execution->symbolTable);
+	}
+	return execution->satSession;
+}
+
+/**
+ * Analyzes and executes a statement as soon as it's reduced, and then
+ * releases it (with its expressions, already lowered into the DAG), so only
+ * the definitions outlive it. After a failure, the following statements are
+ * still analyzed (to report every error), but no longer executed.
+ */
+static void _streamStatement(CompilerState * compilerState, void * statement, void * context) {
+	Execution * execution = context;
+	const boolean analyzed = analyzeStatement(compilerState, statement) == SEMANTIC_ACCEPT;
+	if (execution->succeed) {
+		execution->succeed = analyzed && _executeStatement(execution, statement);
+	}
+	resetArena(compilerState->statementArena);
+	resetArena(compilerState->expressionArena);
+}
+
+/**
+ * Writes a clause, as soon as it's encoded.
+ */
+static void _writeClause(const Literal * literals, const unsigned int count, void * context) {
+	writeDimacsClause(context, literals, count);
+}
+
+/**
+ * Writes a model to the file of models, as soon as it's found.
+ */
+static void _writeModel(const CompiledFormula * compiledFormula, const uint64_t valuation, void * context) {
+	writeModel(context, valuation);
+}
+
+/* PUBLIC FUNCTIONS */
+
+void beginStreamingExecution(CompilerState * compilerState) {
+	logDebugging(_logger, "Executing the program, statement by statement...");
+	compilerState->statementHandler = _streamStatement;
+	compilerState->statementContext = _createExecution(compilerState->symbolTable);
+}
+
+InterpretationStatus endStreamingExecution(CompilerState * compilerState) {
+	Execution * execution = compilerState->statementContext;
+	const boolean succeed = execution->succeed;
+	logDebugging(_logger, "Releasing the statements (%zu bytes in %zu blocks)...",
+		compilerState->statementArena->allocatedBytes, compilerState->statementArena->blocks);
+	_destroyExecution(execution);
+	compilerState->statementHandler = NULL;
+	compilerState->statementContext = NULL;
+	logDebugging(_logger, "Execution is done.");
+	return succeed ? INTERPRETATION_SUCCEED : INTERPRETATION_FAILED;
+}
+
+InterpretationStatus interpret(CompilerState * compilerState) {
+	logDebugging(_logger, "Executing the program...");
+	Execution * execution = _createExecution(compilerState->symbolTable);
+	const Program * program = compilerState->abstractSyntaxtTree;
+	for (unsigned int k = 0; k < program->count; ++k) {
+		if (program->statements[k]->type == DEFINE_FORMULA) {
+			dagFormula(execution->formulaDag, program->statements[k]->defineFormula->name);
+		}
+	}
+	logDebugging(_logger, "Releasing the expressions of the AST (%zu bytes in %zu blocks)...",
+		compilerState->expressionArena->allocatedBytes, compilerState->expressionArena->blocks);
+	destroyArena(compilerState->expressionArena);
+	compilerState->expressionArena = NULL;
+	boolean succeed = true;
+	for (unsigned int k = 0; k < program->count && succeed; ++k) {
+		succeed = _executeStatement(execution, program->statements[k]);
+	}
+	_destroyExecution(execution);
+	logDebugging(_logger, "Execution is done.");
+	return succeed ? INTERPRETATION_SUCCEED : INTERPRETATION_FAILED;
+}
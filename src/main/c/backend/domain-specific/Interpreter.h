@@ -0,0 +1,82 @@
+#ifndef INTERPRETER_HEADER
+#define INTERPRETER_HEADER
+
+#include "../../frontend/semantic-analysis/SemanticAnalyzer.h"
+#include "../../frontend/syntactic-analysis/AbstractSyntaxTree.h"
+#include "../../shared/CompilerState.h"
+#include "../../shared/Environment.h"
+#include "../../shared/Identifier.h"
+#include "../../shared/Logger.h"
+#include "../../shared/String.h"
+#include "../../shared/SymbolTable.h"
+#include "../../shared/Type.h"
+#include "../code-generation/DimacsWriter.h"
+#include "../code-generation/Generator.h"
+#include "../code-generation/ModelWriter.h"
+#include "AdequacyChecker.h"
+#include "BddSession.h"
+#include "CnfEncoder.h"
+#include "FormulaDag.h"
+#include "ModelCounter.h"
+#include "SatSession.h"
+#include "SatSolver.h"
+#include "TruthTableEngine.h"
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Initialize module's internal state. */
+void initializeInterpreterModule();
+
+/** Shutdown module's internal state. */
+void shutdownInterpreterModule();
+
+/**
+ * With the automatic engine, the formulas with more variables than this are
+ * classified with the SAT session of the execution, instead of enumerating
+ * their valuations.
+ */
+#define SAT_CLASSIFICATION_THRESHOLD 24
+
+/**
+ * With the automatic engine, the formulas with more variables than this are
+ * counted with the model counter, instead of enumerating their valuations.
+ * It's higher than the classification threshold: the solver stops at the
+ * first model, but the counter must cover every one of them, and its worst
+ * case (a formula without structure) is slower than the enumeration.
+ */
+#define COUNT_ENUMERATION_THRESHOLD 28
+
+typedef enum {
+	INTERPRETATION_SUCCEED,
+	INTERPRETATION_FAILED
+} InterpretationStatus;
+
+/**
+ * Lowers every formula of the program into the DAG (releasing the expressions
+ * of the AST afterwards), and then executes every statement in source order,
+ * generating the result of each one. Every formula is compiled at most once. The statements
+ * that reference undefined names are skipped (the semantic-analysis phase
+ * already reported them), but a valuation that does not assign every variable
+ * of a formula, or a formula that cannot be compiled, fails the execution.
+ */
+InterpretationStatus interpret(CompilerState * compilerState);
+
+/**
+ * Starts a streaming execution: from now on, the parser hands each statement
+ * over as soon as it's reduced, and it's analyzed, executed and released right
+ * away (so a formula or a valuation must be defined before its first use).
+ * The memory grows with the live definitions, not with the statements.
+ */
+void beginStreamingExecution(CompilerState * compilerState);
+
+/**
+ * Finishes a streaming execution, after the program was parsed. It fails if
+ * any statement failed its analysis or its execution (the results of the
+ * statements before it were already generated).
+ */
+InterpretationStatus endStreamingExecution(CompilerState * compilerState);
+
+#endif
@@ -0,0 +1,757 @@
+#include "ModelCounter.h"
+
+/* MODULE INTERNAL STATE */
+
+#define ACTIVITY_DECAY_PERIOD 256
+#define INITIAL_CACHE_SIZE (1u << 10)
+#define INITIAL_LEVEL_CAPACITY 64
+
+static Logger * _logger = NULL;
+
+void initializeModelCounterModule() {
+	_logger = createLogger("ModelCounter");
+}
+
+void shutdownModelCounterModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/**
+ * A component counted so far. Its key is the amount of clauses, the amount
+ * of variables, and then the clauses and the variables, sorted: the clauses
+ * left of a component are its original clauses restricted to its variables
+ * (every other literal in them is false), so the key identifies them.
+ */
+typedef struct {
+	unsigned int * key;
+	unsigned int keyLength;
+	uint64_t hash;
+	Natural * models;
+} CachedComponent;
+
+/**
+ * A clause that watches a literal, and another literal of it (the blocker).
+ * If the blocker is true, the clause is satisfied, and can be skipped
+ * without touching its literals.
+ */
+typedef struct {
+	unsigned int clause;
+	Literal blocker;
+} Watch;
+
+typedef struct {
+	Watch * watches;
+	unsigned int size;
+	unsigned int capacity;
+} WatchList;
+
+/**
+ * The scratch memory of one level of the search (a level finds the
+ * components of some clauses, and then branches on each component). The
+ * levels reuse their memory, so the search doesn't allocate, except to grow
+ * it, and to keep a component in the cache.
+ */
+typedef struct {
+	unsigned int * clauses;
+	unsigned int clauseCapacity;
+	unsigned int * variables;
+	unsigned int variableCapacity;
+	unsigned int * clauseStarts;
+	unsigned int * variableStarts;
+	unsigned int startCapacity;
+	unsigned int * key;
+	unsigned int keyCapacity;
+	Natural * componentModels;
+	Natural * branchModels;
+} CountingLevel;
+
+/**
+ * The state of a count. The literals of the clauses are kept one after
+ * another (without the terminators of the CNF), and the clauses of each
+ * literal are kept in a single array, by literal (the literal "l" is the
+ * index 2 * |l| + (l < 0)). The first 2 literals of a clause are the
+ * watched ones.
+ */
+typedef struct {
+	unsigned int variableCount;
+	unsigned int columnCount;
+
+	unsigned int clauseCount;
+	size_t * clauseStarts;
+	Literal * literals;
+
+	// The variable defined by each clause: its highest one, because the
+	// encoding creates the variable of a connective after its operands.
+	unsigned int * definitions;
+
+	unsigned int * occurrenceStarts;
+	unsigned int * occurrences;
+
+	// The clauses that watch each literal (by literal).
+	WatchList * watches;
+
+	// The value of each variable (1, -1, or 0 if unassigned), and the
+	// assigned literals, in order.
+	signed char * values;
+	Literal * trail;
+	unsigned int trailCount;
+	unsigned int propagated;
+
+	// The marks that split the clauses into components: a clause or a
+	// variable is marked if its mark is the current epoch.
+	uint64_t * clauseMarks;
+	uint64_t * variableMarks;
+	uint64_t epoch;
+
+	// The pending clauses where each variable is an operand (and not the
+	// defined one), and the definitions left without them.
+	unsigned int * uses;
+	unsigned int * unused;
+
+	// The VSADS heuristic: the occurrences of each column in a component,
+	// plus its activity (i.e., its recent conflicts, halved periodically).
+	unsigned int * scores;
+	unsigned int * activities;
+
+	CountingLevel * levels;
+	unsigned int levelCapacity;
+	unsigned int level;
+
+	CachedComponent * cache;
+	unsigned int cacheSize;
+	unsigned int cacheCount;
+
+	uint64_t decisions;
+	uint64_t conflicts;
+	uint64_t components;
+	uint64_t cacheLookups;
+	uint64_t cacheHits;
+} ModelCounter;
+
+/* PRIVATE FUNCTIONS */
+
+static void _appendWatch(WatchList * list, const unsigned int clause, const Literal blocker);
+static boolean _assign(ModelCounter * modelCounter, const Literal literal);
+static unsigned int _branchVariable(ModelCounter * modelCounter, const unsigned int * clauses, const unsigned int clauseCount,
+	const unsigned int * variables, const unsigned int variableCount);
+static void _bumpClause(ModelCounter * modelCounter, const unsigned int clause);
+static void _cacheComponent(ModelCounter * modelCounter, const unsigned int * key, const unsigned int keyLength, const uint64_t hash, const Natural * models);
+static void _clearCache(ModelCounter * modelCounter);
+static int _compareUnsigned(const void * left, const void * right);
+static void _countClauses(ModelCounter * modelCounter, const unsigned int * clauses, const unsigned int clauseCount,
+	const unsigned int * variables, const unsigned int variableCount, Natural * models);
+static void _countComponent(ModelCounter * modelCounter, unsigned int * clauses, const unsigned int clauseCount,
+	unsigned int * variables, const unsigned int variableCount, Natural * models);
+static void _dropUnusedDefinitions(ModelCounter * modelCounter, const unsigned int * clauses, const unsigned int clauseCount, const uint64_t pendingEpoch);
+static unsigned int * _growScratch(unsigned int * scratch, unsigned int * capacity, const unsigned int size);
+static uint64_t _hashKey(const unsigned int * key, const unsigned int keyLength);
+static boolean _isSatisfied(const ModelCounter * modelCounter, const unsigned int clause);
+static unsigned int _literalIndex(const Literal literal);
+static signed char _literalValue(const ModelCounter * modelCounter, const Literal literal);
+static const Natural * _lookupComponent(ModelCounter * modelCounter, const unsigned int * key, const unsigned int keyLength, const uint64_t hash);
+static boolean _propagate(ModelCounter * modelCounter);
+static void _undo(ModelCounter * modelCounter, const unsigned int trailCount);
+
+/**
+ * Appends a watch to a list, growing it if needed.
+ */
+static void _appendWatch(WatchList * list, const unsigned int clause, const Literal blocker) {
+	if (list->size == list->capacity) {
+		list->capacity = list->capacity == 0 ? 4 : 2 * list->capacity;
+		list->watches = realloc(list->watches, list->capacity * sizeof(Watch));
+	}
+	list->watches[list->size].clause = clause;
+	list->watches[list->size++].blocker = blocker;
+}
+
+/**
+ * Assigns a literal, unless it's already assigned. Returns false if its
+ * negation is assigned.
+ */
+static boolean _assign(ModelCounter * modelCounter, const Literal literal) {
+	const unsigned int variable = literal < 0 ? -literal : literal;
+	const signed char value = literal < 0 ? -1 : 1;
+	if (modelCounter->values[variable] != 0) {
+		return modelCounter->values[variable] == value;
+	}
+	modelCounter->values[variable] = value;
+	modelCounter->trail[modelCounter->trailCount++] = literal;
+	return true;
+}
+
+/**
+ * The variable to branch on in a component: the column with the highest
+ * VSADS score. The auxiliary variables are defined by the columns, so once
+ * the columns are assigned, the propagation assigns them, and branching on
+ * them would only split the same models. A component without columns (which
+ * the encoding of Tseitin never leaves) branches on any of its variables.
+ */
+static unsigned int _branchVariable(ModelCounter * modelCounter, const unsigned int * clauses, const unsigned int clauseCount,
+		const unsigned int * variables, const unsigned int variableCount) {
+	unsigned int * scores = modelCounter->scores;
+	for (unsigned int k = 0; k < clauseCount; ++k) {
+		for (size_t l = modelCounter->clauseStarts[clauses[k]]; l < modelCounter->clauseStarts[clauses[k] + 1]; ++l) {
+			const Literal literal = modelCounter->literals[l];
+			++scores[literal < 0 ? -literal : literal];
+		}
+	}
+	unsigned int branch = 0;
+	unsigned int branchScore = 0;
+	for (unsigned int k = 0; k < variableCount; ++k) {
+		const unsigned int variable = variables[k];
+		const unsigned int score = scores[variable] + modelCounter->activities[variable];
+		if (variable <= modelCounter->columnCount && (branch == 0 || branchScore < score)) {
+			branch = variable;
+			branchScore = score;
+		}
+	}
+	for (unsigned int k = 0; k < clauseCount; ++k) {
+		for (size_t l = modelCounter->clauseStarts[clauses[k]]; l < modelCounter->clauseStarts[clauses[k] + 1]; ++l) {
+			const Literal literal = modelCounter->literals[l];
+			scores[literal < 0 ? -literal : literal] = 0;
+		}
+	}
+	return branch == 0 ? variables[0] : branch;
+}
+
+/**
+ * Increases the activity of the variables of a conflicting clause, halving
+ * every activity once in a while, so the recent conflicts weigh more.
+ */
+static void _bumpClause(ModelCounter * modelCounter, const unsigned int clause) {
+	for (size_t l = modelCounter->clauseStarts[clause]; l < modelCounter->clauseStarts[clause + 1]; ++l) {
+		const Literal literal = modelCounter->literals[l];
+		++modelCounter->activities[literal < 0 ? -literal : literal];
+	}
+	if (++modelCounter->conflicts % ACTIVITY_DECAY_PERIOD == 0) {
+		for (unsigned int variable = 1; variable <= modelCounter->variableCount; ++variable) {
+			modelCounter->activities[variable] >>= 1;
+		}
+	}
+}
+
+/**
+ * Keeps a copy of the count of a component. The cache is emptied once it's
+ * full, and it grows while it's half full.
+ */
+static void _cacheComponent(ModelCounter * modelCounter, const unsigned int * key, const unsigned int keyLength, const uint64_t hash, const Natural * models) {
+	if (MAX_CACHED_COMPONENTS <= modelCounter->cacheCount) {
+		_clearCache(modelCounter);
+	}
+	if (modelCounter->cacheSize <= 2 * modelCounter->cacheCount) {
+		CachedComponent * cache = modelCounter->cache;
+		const unsigned int cacheSize = modelCounter->cacheSize;
+		modelCounter->cacheSize *= 2;
+		modelCounter->cache = calloc(modelCounter->cacheSize, sizeof(CachedComponent));
+		for (unsigned int k = 0; k < cacheSize; ++k) {
+			if (cache[k].key != NULL) {
+				unsigned int slot = cache[k].hash & (modelCounter->cacheSize - 1);
+				while (modelCounter->cache[slot].key != NULL) {
+					slot = (slot + 1) & (modelCounter->cacheSize - 1);
+				}
+				modelCounter->cache[slot] = cache[k];
+			}
+		}
+		free(cache);
+	}
+	unsigned int slot = hash & (modelCounter->cacheSize - 1);
+	while (modelCounter->cache[slot].key != NULL) {
+		slot = (slot + 1) & (modelCounter->cacheSize - 1);
+	}
+	CachedComponent * component = &modelCounter->cache[slot];
+	component->key = malloc(keyLength * sizeof(unsigned int));
+	memcpy(component->key, key, keyLength * sizeof(unsigned int));
+	component->keyLength = keyLength;
+	component->hash = hash;
+	component->models = createNatural(0);
+	copyNatural(component->models, models);
+	++modelCounter->cacheCount;
+}
+
+/**
+ * Releases every component of the cache.
+ */
+static void _clearCache(ModelCounter * modelCounter) {
+	for (unsigned int k = 0; k < modelCounter->cacheSize; ++k) {
+		if (modelCounter->cache[k].key != NULL) {
+			free(modelCounter->cache[k].key);
+			destroyNatural(modelCounter->cache[k].models);
+			modelCounter->cache[k].key = NULL;
+		}
+	}
+	modelCounter->cacheCount = 0;
+}
+
+/**
+ * Compares 2 unsigned integers, for "qsort".
+ */
+static int _compareUnsigned(const void * left, const void * right) {
+	const unsigned int leftValue = *(const unsigned int *) left;
+	const unsigned int rightValue = *(const unsigned int *) right;
+	return (leftValue > rightValue) - (leftValue < rightValue);
+}
+
+/**
+ * Counts the models of some clauses over some variables, under the current
+ * assignment: the clauses already satisfied are dropped (and so are the
+ * definitions that nothing uses anymore), the rest of them are split into components (which are counted independently, and
+ * multiplied), and every column left without clauses doubles the count.
+ */
+static void _countClauses(ModelCounter * modelCounter, const unsigned int * clauses, const unsigned int clauseCount,
+		const unsigned int * variables, const unsigned int variableCount, Natural * models) {
+	const uint64_t pendingEpoch = ++modelCounter->epoch;
+	for (unsigned int k = 0; k < clauseCount; ++k) {
+		if (!_isSatisfied(modelCounter, clauses[k])) {
+			modelCounter->clauseMarks[clauses[k]] = pendingEpoch;
+		}
+	}
+	_dropUnusedDefinitions(modelCounter, clauses, clauseCount, pendingEpoch);
+	if (modelCounter->level == modelCounter->levelCapacity) {
+		modelCounter->levelCapacity *= 2;
+		modelCounter->levels = realloc(modelCounter->levels, modelCounter->levelCapacity * sizeof(CountingLevel));
+		memset(&modelCounter->levels[modelCounter->level], 0, modelCounter->level * sizeof(CountingLevel));
+	}
+	// The levels may move while deeper levels are counted, but not their
+	// scratch memory, so this level keeps its own pointers to it.
+	CountingLevel * level = &modelCounter->levels[modelCounter->level++];
+	if (level->componentModels == NULL) {
+		level->componentModels = createNatural(0);
+		level->branchModels = createNatural(0);
+	}
+	unsigned int * componentClauses = level->clauses = _growScratch(level->clauses, &level->clauseCapacity, clauseCount);
+	unsigned int * componentVariables = level->variables;
+	if (level->startCapacity < 1 + clauseCount) {
+		level->clauseStarts = _growScratch(level->clauseStarts, &level->startCapacity, 1 + clauseCount);
+		level->variableStarts = realloc(level->variableStarts, level->startCapacity * sizeof(unsigned int));
+	}
+	unsigned int * clauseStarts = level->clauseStarts;
+	unsigned int * variableStarts = level->variableStarts;
+	Natural * componentModels = level->componentModels;
+	// A breadth-first search from each pending clause, through the unassigned
+	// variables, finds a component. The components are laid out one after
+	// another, and only counted once every one of them is found, because
+	// counting them moves the epoch.
+	const uint64_t visitedEpoch = ++modelCounter->epoch;
+	unsigned int componentCount = 0;
+	unsigned int clauseTotal = 0;
+	unsigned int variableTotal = 0;
+	for (unsigned int k = 0; k < clauseCount; ++k) {
+		if (modelCounter->clauseMarks[clauses[k]] != pendingEpoch) {
+			continue;
+		}
+		clauseStarts[componentCount] = clauseTotal;
+		variableStarts[componentCount] = variableTotal;
+		++componentCount;
+		modelCounter->clauseMarks[clauses[k]] = visitedEpoch;
+		componentClauses[clauseTotal++] = clauses[k];
+		for (unsigned int next = clauseStarts[componentCount - 1]; next < clauseTotal; ++next) {
+			const unsigned int clause = componentClauses[next];
+			for (size_t l = modelCounter->clauseStarts[clause]; l < modelCounter->clauseStarts[clause + 1]; ++l) {
+				const Literal literal = modelCounter->literals[l];
+				const unsigned int variable = literal < 0 ? -literal : literal;
+				if (modelCounter->values[variable] != 0 || modelCounter->variableMarks[variable] == visitedEpoch) {
+					continue;
+				}
+				modelCounter->variableMarks[variable] = visitedEpoch;
+				if (variableTotal == level->variableCapacity) {
+					componentVariables = level->variables = _growScratch(level->variables, &level->variableCapacity, 1 + variableTotal);
+				}
+				componentVariables[variableTotal++] = variable;
+				for (unsigned int o = modelCounter->occurrenceStarts[2 * variable]; o < modelCounter->occurrenceStarts[2 * variable + 2]; ++o) {
+					const unsigned int neighbour = modelCounter->occurrences[o];
+					if (modelCounter->clauseMarks[neighbour] == pendingEpoch) {
+						modelCounter->clauseMarks[neighbour] = visitedEpoch;
+						componentClauses[clauseTotal++] = neighbour;
+					}
+				}
+			}
+		}
+	}
+	clauseStarts[componentCount] = clauseTotal;
+	variableStarts[componentCount] = variableTotal;
+	unsigned int freeColumns = 0;
+	for (unsigned int k = 0; k < variableCount; ++k) {
+		const unsigned int variable = variables[k];
+		if (variable <= modelCounter->columnCount && modelCounter->values[variable] == 0 && modelCounter->variableMarks[variable] != visitedEpoch) {
+			++freeColumns;
+		}
+	}
+	setNatural(models, 1);
+	for (unsigned int c = 0; c < componentCount && !isZeroNatural(models); ++c) {
+		++modelCounter->components;
+		_countComponent(modelCounter, &componentClauses[clauseStarts[c]], clauseStarts[c + 1] - clauseStarts[c],
+			&componentVariables[variableStarts[c]], variableStarts[c + 1] - variableStarts[c], componentModels);
+		multiplyNatural(models, componentModels);
+	}
+	shiftNatural(models, freeColumns);
+	--modelCounter->level;
+}
+
+/**
+ * Counts the models of a component (i.e., clauses connected through their
+ * unassigned variables), from the cache or branching on one of its columns.
+ * It runs on the scratch memory of the level that found the component.
+ */
+static void _countComponent(ModelCounter * modelCounter, unsigned int * clauses, const unsigned int clauseCount,
+		unsigned int * variables, const unsigned int variableCount, Natural * models) {
+	qsort(clauses, clauseCount, sizeof(unsigned int), _compareUnsigned);
+	qsort(variables, variableCount, sizeof(unsigned int), _compareUnsigned);
+	CountingLevel * level = &modelCounter->levels[modelCounter->level - 1];
+	const unsigned int keyLength = 2 + clauseCount + variableCount;
+	unsigned int * key = level->key = _growScratch(level->key, &level->keyCapacity, keyLength);
+	Natural * branchModels = level->branchModels;
+	key[0] = clauseCount;
+	key[1] = variableCount;
+	memcpy(&key[2], clauses, clauseCount * sizeof(unsigned int));
+	memcpy(&key[2 + clauseCount], variables, variableCount * sizeof(unsigned int));
+	const uint64_t hash = _hashKey(key, keyLength);
+	const Natural * cached = _lookupComponent(modelCounter, key, keyLength, hash);
+	if (cached != NULL) {
+		copyNatural(models, cached);
+		return;
+	}
+	const unsigned int branch = _branchVariable(modelCounter, clauses, clauseCount, variables, variableCount);
+	setNatural(models, 0);
+	const unsigned int trailCount = modelCounter->trailCount;
+	for (int sign = -1; sign <= 1; sign += 2) {
+		++modelCounter->decisions;
+		_assign(modelCounter, sign * (Literal) branch);
+		if (_propagate(modelCounter)) {
+			_countClauses(modelCounter, clauses, clauseCount, variables, variableCount, branchModels);
+			addNatural(models, branchModels);
+		}
+		_undo(modelCounter, trailCount);
+	}
+	_cacheComponent(modelCounter, key, keyLength, hash, models);
+}
+
+/**
+ * Drops the pending clauses that define an unassigned auxiliary variable
+ * which no pending clause uses as an operand (e.g., the operands of a
+ * conjunction with a false operand), and then the ones that only those
+ * clauses used. Every assignment of the operands of a definition extends to
+ * exactly one value of its variable, so the count doesn't change, but the
+ * columns left without clauses become free, instead of being branched on.
+ */
+static void _dropUnusedDefinitions(ModelCounter * modelCounter, const unsigned int * clauses, const unsigned int clauseCount, const uint64_t pendingEpoch) {
+	unsigned int * uses = modelCounter->uses;
+	unsigned int * unused = modelCounter->unused;
+	unsigned int unusedCount = 0;
+	for (unsigned int k = 0; k < clauseCount; ++k) {
+		if (modelCounter->clauseMarks[clauses[k]] == pendingEpoch) {
+			for (size_t l = modelCounter->clauseStarts[clauses[k]]; l < modelCounter->clauseStarts[clauses[k] + 1]; ++l) {
+				const Literal literal = modelCounter->literals[l];
+				const unsigned int variable = literal < 0 ? -literal : literal;
+				uses[variable] += variable != modelCounter->definitions[clauses[k]];
+			}
+		}
+	}
+	// The variables are queued once: when their last use is dropped, or at
+	// first, by the first clause of their definition.
+	for (unsigned int k = 0; k < clauseCount; ++k) {
+		const unsigned int variable = modelCounter->definitions[clauses[k]];
+		if (modelCounter->clauseMarks[clauses[k]] == pendingEpoch && modelCounter->columnCount < variable && uses[variable] == 0
+			&& modelCounter->values[variable] == 0) {
+			uses[variable] = UINT_MAX;
+			unused[unusedCount++] = variable;
+		}
+	}
+	while (0 < unusedCount) {
+		const unsigned int variable = unused[--unusedCount];
+		for (unsigned int o = modelCounter->occurrenceStarts[2 * variable]; o < modelCounter->occurrenceStarts[2 * variable + 2]; ++o) {
+			const unsigned int clause = modelCounter->occurrences[o];
+			if (modelCounter->clauseMarks[clause] != pendingEpoch || modelCounter->definitions[clause] != variable) {
+				continue;
+			}
+			modelCounter->clauseMarks[clause] = 0;
+			for (size_t l = modelCounter->clauseStarts[clause]; l < modelCounter->clauseStarts[clause + 1]; ++l) {
+				const Literal literal = modelCounter->literals[l];
+				const unsigned int operand = literal < 0 ? -literal : literal;
+				if (operand != variable && --uses[operand] == 0 && modelCounter->columnCount < operand && modelCounter->values[operand] == 0) {
+					uses[operand] = UINT_MAX;
+					unused[unusedCount++] = operand;
+				}
+			}
+		}
+	}
+	for (unsigned int k = 0; k < clauseCount; ++k) {
+		for (size_t l = modelCounter->clauseStarts[clauses[k]]; l < modelCounter->clauseStarts[clauses[k] + 1]; ++l) {
+			const Literal literal = modelCounter->literals[l];
+			uses[literal < 0 ? -literal : literal] = 0;
+		}
+	}
+}
+
+/**
+ * Grows some scratch memory to hold at least the specified amount of
+ * integers (at least doubling it, so it's grown a few times per count).
+ */
+static unsigned int * _growScratch(unsigned int * scratch, unsigned int * capacity, const unsigned int size) {
+	if (size <= *capacity) {
+		return scratch;
+	}
+	*capacity = size < 2 * *capacity ? 2 * *capacity : size;
+	return realloc(scratch, *capacity * sizeof(unsigned int));
+}
+
+/**
+ * The FNV-1a hash of the key of a component.
+ */
+static uint64_t _hashKey(const unsigned int * key, const unsigned int keyLength) {
+	uint64_t hash = 0xCBF29CE484222325ull;
+	for (unsigned int k = 0; k < keyLength; ++k) {
+		hash = (hash ^ key[k]) * 0x100000001B3ull;
+	}
+	return hash ^ (hash >> 29);
+}
+
+/**
+ * Returns true if a clause has a true literal.
+ */
+static boolean _isSatisfied(const ModelCounter * modelCounter, const unsigned int clause) {
+	for (size_t l = modelCounter->clauseStarts[clause]; l < modelCounter->clauseStarts[clause + 1]; ++l) {
+		if (_literalValue(modelCounter, modelCounter->literals[l]) == 1) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * The index of a literal in the occurrences and in the watches.
+ */
+static unsigned int _literalIndex(const Literal literal) {
+	return literal < 0 ? 2 * (unsigned int) -literal + 1 : 2 * (unsigned int) literal;
+}
+
+/**
+ * The value of a literal: 1 if it's true, -1 if it's false, or 0 if its
+ * variable is unassigned.
+ */
+static signed char _literalValue(const ModelCounter * modelCounter, const Literal literal) {
+	const signed char value = modelCounter->values[literal < 0 ? -literal : literal];
+	return literal < 0 ? -value : value;
+}
+
+/**
+ * The count of a component, if it's in the cache (or NULL).
+ */
+static const Natural * _lookupComponent(ModelCounter * modelCounter, const unsigned int * key, const unsigned int keyLength, const uint64_t hash) {
+	++modelCounter->cacheLookups;
+	for (unsigned int slot = hash & (modelCounter->cacheSize - 1); modelCounter->cache[slot].key != NULL; slot = (slot + 1) & (modelCounter->cacheSize - 1)) {
+		const CachedComponent * component = &modelCounter->cache[slot];
+		if (component->hash == hash && component->keyLength == keyLength && memcmp(component->key, key, keyLength * sizeof(unsigned int)) == 0) {
+			++modelCounter->cacheHits;
+			return component->models;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * Propagates the assigned literals through the watched literals (i.e.,
+ * assigns the last literal of every clause whose other literals are false).
+ * Returns false on a conflict. The watches stay valid when the search
+ * backtracks, so undoing an assignment never touches them.
+ */
+static boolean _propagate(ModelCounter * modelCounter) {
+	boolean consistent = true;
+	while (consistent && modelCounter->propagated < modelCounter->trailCount) {
+		const Literal falseLiteral = -modelCounter->trail[modelCounter->propagated++];
+		WatchList * watches = &modelCounter->watches[_literalIndex(falseLiteral)];
+		unsigned int read = 0;
+		unsigned int write = 0;
+		while (read < watches->size) {
+			const Watch watch = watches->watches[read++];
+			if (_literalValue(modelCounter, watch.blocker) == 1) {
+				watches->watches[write++] = watch;
+				continue;
+			}
+			const size_t start = modelCounter->clauseStarts[watch.clause];
+			const size_t end = modelCounter->clauseStarts[watch.clause + 1];
+			Literal * literals = &modelCounter->literals[start];
+			if (literals[0] == falseLiteral) {
+				literals[0] = literals[1];
+				literals[1] = falseLiteral;
+			}
+			if (literals[0] != watch.blocker && _literalValue(modelCounter, literals[0]) == 1) {
+				watches->watches[write].clause = watch.clause;
+				watches->watches[write++].blocker = literals[0];
+				continue;
+			}
+			boolean moved = false;
+			for (size_t k = 2; k < end - start && !moved; ++k) {
+				if (_literalValue(modelCounter, literals[k]) != -1) {
+					literals[1] = literals[k];
+					literals[k] = falseLiteral;
+					_appendWatch(&modelCounter->watches[_literalIndex(literals[1])], watch.clause, literals[0]);
+					moved = true;
+				}
+			}
+			if (moved) {
+				continue;
+			}
+			watches->watches[write].clause = watch.clause;
+			watches->watches[write++].blocker = literals[0];
+			if (_literalValue(modelCounter, literals[0]) == -1) {
+				_bumpClause(modelCounter, watch.clause);
+				consistent = false;
+				while (read < watches->size) {
+					watches->watches[write++] = watches->watches[read++];
+				}
+			}
+			else {
+				_assign(modelCounter, literals[0]);
+			}
+		}
+		watches->size = write;
+	}
+	return consistent;
+}
+
+/**
+ * Unassigns the literals assigned after the specified point of the trail.
+ */
+static void _undo(ModelCounter * modelCounter, const unsigned int trailCount) {
+	while (trailCount < modelCounter->trailCount) {
+		const Literal literal = modelCounter->trail[--modelCounter->trailCount];
+		modelCounter->values[literal < 0 ? -literal : literal] = 0;
+	}
+	modelCounter->propagated = trailCount;
+}
+
+/* PUBLIC FUNCTIONS */
+
+void countCnfModels(const Cnf * cnf, const Literal root, Natural * models) {
+	const unsigned int variableCount = cnf->header.variableCount;
+	ModelCounter modelCounter = {
+		.variableCount = variableCount,
+		.columnCount = cnf->header.columnCount,
+		.clauseCount = 0,
+		.literals = malloc((1 + cnf->literalCount) * sizeof(Literal)),
+		.values = calloc(1 + variableCount, sizeof(signed char)),
+		.trail = calloc(1 + variableCount, sizeof(Literal)),
+		.variableMarks = calloc(1 + variableCount, sizeof(uint64_t)),
+		.watches = calloc(2 * variableCount + 2, sizeof(WatchList)),
+		.uses = calloc(1 + variableCount, sizeof(unsigned int)),
+		.unused = malloc((1 + variableCount) * sizeof(unsigned int)),
+		.scores = calloc(1 + variableCount, sizeof(unsigned int)),
+		.activities = calloc(1 + variableCount, sizeof(unsigned int)),
+		.levelCapacity = INITIAL_LEVEL_CAPACITY,
+		.levels = calloc(INITIAL_LEVEL_CAPACITY, sizeof(CountingLevel)),
+		.cacheSize = INITIAL_CACHE_SIZE,
+		.cache = calloc(INITIAL_CACHE_SIZE, sizeof(CachedComponent))
+	};
+	// The clauses, and the clauses of each literal (counted, and then placed).
+	for (size_t l = 0; l < cnf->literalCount; ++l) {
+		modelCounter.clauseCount += cnf->literals[l] == 0;
+	}
+	modelCounter.clauseStarts = malloc((1 + modelCounter.clauseCount) * sizeof(size_t));
+	modelCounter.clauseMarks = calloc(1 + modelCounter.clauseCount, sizeof(uint64_t));
+	modelCounter.definitions = calloc(1 + modelCounter.clauseCount, sizeof(unsigned int));
+	modelCounter.occurrenceStarts = calloc(2 * variableCount + 3, sizeof(unsigned int));
+	size_t literalCount = 0;
+	unsigned int clause = 0;
+	modelCounter.clauseStarts[0] = 0;
+	for (size_t l = 0; l < cnf->literalCount; ++l) {
+		if (cnf->literals[l] == 0) {
+			modelCounter.clauseStarts[++clause] = literalCount;
+		}
+		else {
+			const unsigned int variable = cnf->literals[l] < 0 ? -cnf->literals[l] : cnf->literals[l];
+			if (modelCounter.definitions[clause] < variable) {
+				modelCounter.definitions[clause] = variable;
+			}
+			modelCounter.literals[literalCount++] = cnf->literals[l];
+			++modelCounter.occurrenceStarts[_literalIndex(cnf->literals[l]) + 1];
+		}
+	}
+	for (unsigned int index = 1; index < 2 * variableCount + 3; ++index) {
+		modelCounter.occurrenceStarts[index] += modelCounter.occurrenceStarts[index - 1];
+	}
+	unsigned int * cursors = malloc((2 * variableCount + 2) * sizeof(unsigned int));
+	memcpy(cursors, modelCounter.occurrenceStarts, (2 * variableCount + 2) * sizeof(unsigned int));
+	modelCounter.occurrences = malloc((1 + literalCount) * sizeof(unsigned int));
+	for (clause = 0; clause < modelCounter.clauseCount; ++clause) {
+		for (size_t l = modelCounter.clauseStarts[clause]; l < modelCounter.clauseStarts[clause + 1]; ++l) {
+			modelCounter.occurrences[cursors[_literalIndex(modelCounter.literals[l])]++] = clause;
+		}
+	}
+	free(cursors);
+	setNatural(models, 0);
+	boolean consistent = _assign(&modelCounter, root);
+	for (clause = 0; clause < modelCounter.clauseCount && consistent; ++clause) {
+		const size_t start = modelCounter.clauseStarts[clause];
+		const size_t length = modelCounter.clauseStarts[clause + 1] - start;
+		if (length <= 1) {
+			consistent = length == 1 && _assign(&modelCounter, modelCounter.literals[start]);
+		}
+		else {
+			_appendWatch(&modelCounter.watches[_literalIndex(modelCounter.literals[start])], clause, modelCounter.literals[start + 1]);
+			_appendWatch(&modelCounter.watches[_literalIndex(modelCounter.literals[start + 1])], clause, modelCounter.literals[start]);
+		}
+	}
+	if (consistent && _propagate(&modelCounter)) {
+		unsigned int * clauses = malloc((1 + modelCounter.clauseCount) * sizeof(unsigned int));
+		unsigned int * variables = malloc((1 + variableCount) * sizeof(unsigned int));
+		for (clause = 0; clause < modelCounter.clauseCount; ++clause) {
+			clauses[clause] = clause;
+		}
+		for (unsigned int variable = 1; variable <= variableCount; ++variable) {
+			variables[variable - 1] = variable;
+		}
+		_countClauses(&modelCounter, clauses, modelCounter.clauseCount, variables, variableCount, models);
+		free(variables);
+		free(clauses);
+	}
+	logDebugging(_logger, "Counted with %llu decisions, %llu conflicts, %llu components, and %llu of %llu cache hits.",
+		(unsigned long long) modelCounter.decisions, (unsigned long long) modelCounter.conflicts,
+		(unsigned long long) modelCounter.components, (unsigned long long) modelCounter.cacheHits,
+		(unsigned long long) modelCounter.cacheLookups);
+	_clearCache(&modelCounter);
+	free(modelCounter.cache);
+	for (unsigned int k = 0; k < modelCounter.levelCapacity; ++k) {
+		CountingLevel * level = &modelCounter.levels[k];
+		if (level->componentModels != NULL) {
+			destroyNatural(level->componentModels);
+			destroyNatural(level->branchModels);
+		}
+		free(level->key);
+		free(level->variableStarts);
+		free(level->clauseStarts);
+		free(level->variables);
+		free(level->clauses);
+	}
+	free(modelCounter.levels);
+	for (unsigned int index = 0; index < 2 * variableCount + 2; ++index) {
+		free(modelCounter.watches[index].watches);
+	}
+	free(modelCounter.watches);
+	free(modelCounter.activities);
+	free(modelCounter.scores);
+	free(modelCounter.unused);
+	free(modelCounter.uses);
+	free(modelCounter.variableMarks);
+	free(modelCounter.definitions);
+	free(modelCounter.clauseMarks);
+	free(modelCounter.trail);
+	free(modelCounter.values);
+	free(modelCounter.occurrences);
+	free(modelCounter.literals);
+	free(modelCounter.occurrenceStarts);
+	free(modelCounter.clauseStarts);
+}
+
+boolean countFormulaModels(const CompiledFormula * compiledFormula, Natural * models) {
+	Cnf * cnf = encodeFormula(compiledFormula, BOTH_POLARITIES);
+	if (cnf == NULL) {
+		return false;
+	}
+	logDebugging(_logger, "Counting the models of \"%s\" over a CNF of %u variables (%u of them projected) and %llu clauses.",
+		compiledFormula->name->name, cnf->header.variableCount, cnf->header.columnCount, (unsigned long long) cnf->header.clauseCount);
+	countCnfModels(cnf, cnf->header.root, models);
+	destroyCnf(cnf);
+	return true;
+}
@@ -0,0 +1,52 @@
+#ifndef MODEL_COUNTER_HEADER
+#define MODEL_COUNTER_HEADER
+
+#include "../../shared/Logger.h"
+#include "../../shared/Natural.h"
+#include "../../shared/Type.h"
+#include "CnfEncoder.h"
+#include "SatSolver.h"
+#include "TruthTableEngine.h"
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Initialize module's internal state. */
+void initializeModelCounterModule();
+
+/** Shutdown module's internal state. */
+void shutdownModelCounterModule();
+
+/**
+ * The maximum amount of components kept in the cache of a count. Once it's
+ * full, the cache is emptied, so the memory of a count stays bounded (but
+ * the components already counted may be counted again).
+ */
+#define MAX_CACHED_COMPONENTS (1u << 20)
+
+/**
+ * Counts the models of a CNF where the root literal holds, projected on the
+ * columns (i.e., on the variables 1 to "columnCount"). The count is exact,
+ * and it never enumerates the models: it's a DPLL search that splits the
+ * clauses left into components without variables in common (whose counts are
+ * multiplied), and that caches the count of every component, so a component
+ * that appears again under another assignment is counted once. It only
+ * branches on columns (picked by VSADS), and propagates with watched
+ * literals.
+ *
+ * The auxiliary variables must be defined by the columns, as in the encoding
+ * of Tseitin (i.e., the one with both polarities), so every projected model
+ * extends to exactly one model of the CNF. Then, an auxiliary variable is
+ * never free, and only the free columns double the count. Every clause must
+ * define its highest variable, as the clauses of "encodeFormula" do.
+ */
+void countCnfModels(const Cnf * cnf, const Literal root, Natural * models);
+
+/**
+ * Counts the models of a compiled formula, over its columns, with the
+ * encoding of Tseitin. Returns false if the formula cannot be encoded.
+ */
+boolean countFormulaModels(const CompiledFormula * compiledFormula, Natural * models);
+
+#endif
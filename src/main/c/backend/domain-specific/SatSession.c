@@ -0,0 +1,160 @@
+#include "SatSession.h"
+
+/* MODULE INTERNAL STATE */
+
+static Logger * _logger = NULL;
+
+void initializeSatSessionModule() {
+	_logger = createLogger("SatSession");
+}
+
+void shutdownSatSessionModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+struct SatSession {
+	const SymbolTable * symbolTable;
+	SatSolver * satSolver;
+
+	// The encoding of every loaded formula, whose variables are the ones of
+	// the solver.
+	CnfBuilder * cnfBuilder;
+
+	// The literal of every variable (by ordinal), and the root of every
+	// loaded formula (by ordinal), or 0. Both grow with the symbol table.
+	Literal * variables;
+	unsigned int variableCount;
+	Literal * roots;
+	unsigned int formulaCount;
+
+	uint64_t queries;
+};
+
+/* PRIVATE FUNCTIONS */
+
+static void _addClause(const Literal * literals, const unsigned int count, void * context);
+static void _growTables(SatSession * satSession);
+static void _synchronize(SatSession * satSession);
+
+/**
+ * Adds a clause of the encoding to the solver, as soon as it's encoded.
+ */
+static void _addClause(const Literal * literals, const unsigned int count, void * context) {
+	SatSession * satSession = context;
+	_synchronize(satSession);
+	addSatClause(satSession->satSolver, literals, count);
+}
+
+/**
+ * Grows the literals of the variables and the roots of the formulas, by
+ * ordinal, to cover the symbols defined since the last call.
+ */
+static void _growTables(SatSession * satSession) {
+	const unsigned int variableCount = symbolCount(satSession->symbolTable, VARIABLE_SYMBOL);
+	if (satSession->variables == NULL || satSession->variableCount < variableCount) {
+		satSession->variables = realloc(satSession->variables, (1 + variableCount) * sizeof(Literal));
+		memset(&satSession->variables[satSession->variableCount], 0,
+			(1 + variableCount - satSession->variableCount) * sizeof(Literal));
+		satSession->variableCount = variableCount;
+	}
+	const unsigned int formulaCount = symbolCount(satSession->symbolTable, FORMULA_SYMBOL);
+	if (satSession->roots == NULL || satSession->formulaCount < formulaCount) {
+		satSession->roots = realloc(satSession->roots, (1 + formulaCount) * sizeof(Literal));
+		memset(&satSession->roots[satSession->formulaCount], 0,
+			(1 + formulaCount - satSession->formulaCount) * sizeof(Literal));
+		satSession->formulaCount = formulaCount;
+	}
+}
+
+/**
+ * Creates the variables of the encoding that the solver doesn't have yet.
+ */
+static void _synchronize(SatSession * satSession) {
+	while (satVariableCount(satSession->satSolver) < cnfVariableCount(satSession->cnfBuilder)) {
+		newSatVariable(satSession->satSolver);
+	}
+}
+
+/* PUBLIC FUNCTIONS */
+
+SatSession * createSatSession(const SymbolTable * symbolTable) {
+	SatSession * satSession = calloc(1, sizeof(SatSession));
+	satSession->symbolTable = symbolTable;
+	satSession->satSolver = createSatSolver();
+	satSession->cnfBuilder = createCnfBuilder(_addClause, satSession);
+	_growTables(satSession);
+	return satSession;
+}
+
+void destroySatSession(SatSession * satSession) {
+	if (satSession != NULL) {
+		const SatStatistics * statistics = satStatistics(satSession->satSolver);
+		logDebugging(_logger, "Session closed after %llu queries: %u variables, %llu conflicts, %llu learnt clauses.",
+			(unsigned long long) satSession->queries, satVariableCount(satSession->satSolver),
+			(unsigned long long) statistics->conflicts, (unsigned long long) statistics->learntClauses);
+		destroyCnfBuilder(satSession->cnfBuilder);
+		destroySatSolver(satSession->satSolver);
+		free(satSession->variables);
+		free(satSession->roots);
+		free(satSession);
+	}
+}
+
+Literal sessionConnective(SatSession * satSession, const Opcode opcode, const Literal left, const Literal right) {
+	const Literal literal = buildConnective(satSession->cnfBuilder, opcode, left, right, BOTH_POLARITIES);
+	_synchronize(satSession);
+	return literal;
+}
+
+Literal sessionFormula(SatSession * satSession, const CompiledFormula * compiledFormula) {
+	const Symbol * symbol = lookupSymbol(satSession->symbolTable, FORMULA_SYMBOL, compiledFormula->name);
+	_growTables(satSession);
+	Literal * root = &satSession->roots[symbol->ordinal];
+	if (*root != 0) {
+		return *root;
+	}
+	Literal * columns = calloc(1 + compiledFormula->variableCount, sizeof(Literal));
+	for (unsigned int column = 0; column < compiledFormula->variableCount; ++column) {
+		columns[column] = sessionVariable(satSession, compiledFormula->variables[column]);
+	}
+	const unsigned int variables = cnfVariableCount(satSession->cnfBuilder);
+	const uint64_t clauses = cnfClauseCount(satSession->cnfBuilder);
+	// Both polarities, because the same root can be asserted by a query, and
+	// negated by the next one.
+	*root = buildFormula(satSession->cnfBuilder, compiledFormula, columns, BOTH_POLARITIES);
+	_synchronize(satSession);
+	logDebugging(_logger, "Formula \"%s\" loaded with %u new variables and %llu new clauses.", compiledFormula->name->name,
+		cnfVariableCount(satSession->cnfBuilder) - variables, (unsigned long long) (cnfClauseCount(satSession->cnfBuilder) - clauses));
+	free(columns);
+	return *root;
+}
+
+Literal sessionVariable(SatSession * satSession, const Identifier * variable) {
+	const Symbol * symbol = lookupSymbol(satSession->symbolTable, VARIABLE_SYMBOL, variable);
+	_growTables(satSession);
+	Literal * literal = &satSession->variables[symbol->ordinal];
+	if (*literal == 0) {
+		*literal = newCnfVariable(satSession->cnfBuilder);
+		_synchronize(satSession);
+	}
+	return *literal;
+}
+
+SatResult solveSession(SatSession * satSession, const Literal * assumptions, const unsigned int count) {
+	const SatStatistics * statistics = satStatistics(satSession->satSolver);
+	const uint64_t conflicts = statistics->conflicts;
+	const uint64_t decisions = statistics->decisions;
+	const SatResult result = solveSatAssuming(satSession->satSolver, assumptions, count);
+	++satSession->queries;
+	logDebugging(_logger, "Query %llu (%u assumptions) is %s: %llu conflicts, %llu decisions.",
+		(unsigned long long) satSession->queries, count, result == SATISFIABLE ? "satisfiable" : "unsatisfiable",
+		(unsigned long long) (statistics->conflicts - conflicts), (unsigned long long) (statistics->decisions - decisions));
+	return result;
+}
+
+boolean sessionModelValue(const SatSession * satSession, const Literal literal) {
+	const boolean value = satModelValue(satSession->satSolver, 0 < literal ? literal : -literal);
+	return 0 < literal ? value : !value;
+}
@@ -0,0 +1,70 @@
+#ifndef SAT_SESSION_HEADER
+#define SAT_SESSION_HEADER
+
+#include "../../shared/Identifier.h"
+#include "../../shared/Logger.h"
+#include "../../shared/SymbolTable.h"
+#include "../../shared/Type.h"
+#include "CnfEncoder.h"
+#include "SatSolver.h"
+#include "TruthTableEngine.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Initialize module's internal state. */
+void initializeSatSessionModule();
+
+/** Shutdown module's internal state. */
+void shutdownSatSessionModule();
+
+/**
+ * A solver that lives as long as the execution of a program, and answers
+ * every satisfiability query of it. Each formula is encoded and loaded once,
+ * in both polarities, and then queried through assumptions on its root, so
+ * the clauses learnt by a query speed up the next ones. Every formula shares
+ * the variables of the solver, one per variable of the program.
+ */
+typedef struct SatSession SatSession;
+
+/**
+ * Creates an empty session for the program of a symbol table.
+ */
+SatSession * createSatSession(const SymbolTable * symbolTable);
+
+/**
+ * Destroy a session, and its solver.
+ */
+void destroySatSession(SatSession * satSession);
+
+/**
+ * The literal of a built-in connective over 2 literals of the session (e.g.,
+ * the equivalence of 2 formulas).
+ */
+Literal sessionConnective(SatSession * satSession, const Opcode opcode, const Literal left, const Literal right);
+
+/**
+ * The literal that is true if, and only if, a formula is true, loading the
+ * formula the first time. The formulas are hashed structurally, so the
+ * subformulas shared with the formulas already loaded are reused. Returns 0
+ * if the formula cannot be encoded.
+ */
+Literal sessionFormula(SatSession * satSession, const CompiledFormula * compiledFormula);
+
+/**
+ * The literal of a variable of the program.
+ */
+Literal sessionVariable(SatSession * satSession, const Identifier * variable);
+
+/**
+ * Decides the satisfiability of the loaded formulas under some assumptions
+ * (e.g., the root of a formula, or its negation).
+ */
+SatResult solveSession(SatSession * satSession, const Literal * assumptions, const unsigned int count);
+
+/**
+ * The value of a literal in the model found by the last satisfiable query.
+ */
+boolean sessionModelValue(const SatSession * satSession, const Literal literal);
+
+#endif
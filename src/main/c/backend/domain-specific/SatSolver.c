@@ -0,0 +1,784 @@
+#include "SatSolver.h"
+
+/* MODULE INTERNAL STATE */
+
+#define CLAUSE_ACTIVITY_DECAY 0.999
+#define INITIAL_MAX_LEARNT_CLAUSES 2000
+#define MAX_LEARNT_CLAUSES_GROWTH 1.1
+#define RESTART_UNIT 100
+#define VARIABLE_ACTIVITY_DECAY 0.95
+
+// The value of a variable (or literal) that was not assigned yet.
+#define UNASSIGNED -1
+
+// The literal that precedes the first one (used during conflict analysis).
+#define NO_LITERAL UINT_MAX
+
+static Logger * _logger = NULL;
+
+void initializeSatSolverModule() {
+	_logger = createLogger("SatSolver");
+}
+
+void shutdownSatSolverModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/**
+ * Inside the solver, the variable "v" (starting at 0) is the literal "2v",
+ * and its negation is "2v + 1", so literals can index arrays.
+ */
+typedef unsigned int Lit;
+
+typedef struct {
+	boolean learnt;
+	boolean deleted;
+	unsigned int size;
+	unsigned int glue;
+	double activity;
+
+	// The first 2 literals are the watched ones. In the reason of an
+	// implication, the implied literal is the first one.
+	Lit literals[];
+} Clause;
+
+typedef struct {
+	Clause ** clauses;
+	unsigned int size;
+	unsigned int capacity;
+} ClauseList;
+
+/**
+ * A clause that watches a literal, and another literal of it (the blocker).
+ * If the blocker is true, the clause is satisfied, and can be skipped
+ * without touching its memory.
+ */
+typedef struct {
+	Clause * clause;
+	Lit blocker;
+} Watch;
+
+typedef struct {
+	Watch * watches;
+	unsigned int size;
+	unsigned int capacity;
+} WatchList;
+
+struct SatSolver {
+	unsigned int variableCount;
+	unsigned int variableCapacity;
+	boolean consistent;
+
+	// The original and learnt clauses.
+	ClauseList clauses;
+	ClauseList learnts;
+	double maxLearnts;
+
+	// The clauses that watch each literal (by literal).
+	WatchList * watches;
+
+	// The assignment (by variable), and the trail of assigned literals, in
+	// order of assignment, split by decision level.
+	signed char * values;
+	unsigned int * levels;
+	Clause ** reasons;
+	boolean * phases;
+	Lit * trail;
+	unsigned int trailSize;
+	unsigned int * trailLimits;
+	unsigned int decisionLevel;
+	unsigned int propagationHead;
+
+	// The VSIDS heuristic: a max-heap of variables by activity.
+	double * activities;
+	double variableIncrement;
+	double clauseIncrement;
+	unsigned int * heap;
+	unsigned int heapSize;
+	int * heapPositions;
+
+	// Scratch memory of the conflict analysis.
+	boolean * seen;
+	Lit * learnt;
+	unsigned int * levelStamps;
+	unsigned int levelStamp;
+
+	// The last model found.
+	boolean * model;
+
+	SatStatistics statistics;
+};
+
+/* PRIVATE FUNCTIONS */
+
+static void _analyze(SatSolver * satSolver, Clause * conflict, unsigned int * learntSize, unsigned int * backtrackLevel);
+static void _appendClause(ClauseList * list, Clause * clause);
+static void _appendWatch(WatchList * list, Clause * clause, const Lit blocker);
+static void _attachClause(SatSolver * satSolver, Clause * clause);
+static void _backtrack(SatSolver * satSolver, const unsigned int level);
+static void _bumpClause(SatSolver * satSolver, Clause * clause);
+static void _bumpVariable(SatSolver * satSolver, const unsigned int variable);
+static int _compareLearnts(const void * left, const void * right);
+static Clause * _createClause(const Lit * literals, const unsigned int size, const boolean learnt);
+static void _enqueue(SatSolver * satSolver, const Lit literal, Clause * reason);
+static void _heapInsert(SatSolver * satSolver, const unsigned int variable);
+static unsigned int _heapPop(SatSolver * satSolver);
+static void _heapSiftDown(SatSolver * satSolver, unsigned int position);
+static void _heapSiftUp(SatSolver * satSolver, unsigned int position);
+static boolean _isLocked(const SatSolver * satSolver, const Clause * clause);
+static boolean _isRedundant(SatSolver * satSolver, const Lit literal);
+static unsigned int _glue(SatSolver * satSolver, const Lit * literals, const unsigned int size);
+static signed char _literalValue(const SatSolver * satSolver, const Lit literal);
+static uint64_t _luby(uint64_t index);
+static Clause * _propagate(SatSolver * satSolver);
+static void _reduceLearnts(SatSolver * satSolver);
+static Lit _toLit(const Literal literal);
+
+/**
+ * Derives the first-UIP clause of a conflict into the "learnt" scratch
+ * memory, with the asserting literal first, and the literal of the highest
+ * remaining level second (so both can be watched).
+ */
+static void _analyze(SatSolver * satSolver, Clause * conflict, unsigned int * learntSize, unsigned int * backtrackLevel) {
+	unsigned int pending = 0;
+	unsigned int size = 1;
+	Lit literal = NO_LITERAL;
+	unsigned int index = satSolver->trailSize;
+	Clause * clause = conflict;
+	do {
+		if (clause->learnt) {
+			_bumpClause(satSolver, clause);
+		}
+		for (unsigned int k = literal == NO_LITERAL ? 0 : 1; k < clause->size; ++k) {
+			const Lit other = clause->literals[k];
+			const unsigned int variable = other >> 1;
+			if (!satSolver->seen[variable] && 0 < satSolver->levels[variable]) {
+				_bumpVariable(satSolver, variable);
+				satSolver->seen[variable] = true;
+				if (satSolver->levels[variable] == satSolver->decisionLevel) {
+					++pending;
+				}
+				else {
+					satSolver->learnt[size++] = other;
+				}
+			}
+		}
+		while (!satSolver->seen[satSolver->trail[--index] >> 1]);
+		literal = satSolver->trail[index];
+		clause = satSolver->reasons[literal >> 1];
+		satSolver->seen[literal >> 1] = false;
+		--pending;
+	} while (0 < pending);
+	satSolver->learnt[0] = literal ^ 1;
+
+	// Removes the literals implied by the rest of the clause.
+	unsigned int kept = 1;
+	for (unsigned int k = 1; k < size; ++k) {
+		const Lit other = satSolver->learnt[k];
+		if (_isRedundant(satSolver, other)) {
+			satSolver->seen[other >> 1] = false;
+		}
+		else {
+			satSolver->learnt[kept++] = other;
+		}
+	}
+	size = kept;
+	for (unsigned int k = 1; k < size; ++k) {
+		satSolver->seen[satSolver->learnt[k] >> 1] = false;
+	}
+
+	*backtrackLevel = 0;
+	for (unsigned int k = 1; k < size; ++k) {
+		const unsigned int level = satSolver->levels[satSolver->learnt[k] >> 1];
+		if (*backtrackLevel < level) {
+			*backtrackLevel = level;
+			const Lit first = satSolver->learnt[1];
+			satSolver->learnt[1] = satSolver->learnt[k];
+			satSolver->learnt[k] = first;
+		}
+	}
+	*learntSize = size;
+}
+
+/**
+ * Appends a clause to a list, growing it if needed.
+ */
+static void _appendClause(ClauseList * list, Clause * clause) {
+	if (list->size == list->capacity) {
+		list->capacity = list->capacity == 0 ? 4 : 2 * list->capacity;
+		list->clauses = realloc(list->clauses, list->capacity * sizeof(Clause *));
+	}
+	list->clauses[list->size++] = clause;
+}
+
+/**
+ * Appends a watch to a list, growing it if needed.
+ */
+static void _appendWatch(WatchList * list, Clause * clause, const Lit blocker) {
+	if (list->size == list->capacity) {
+		list->capacity = list->capacity == 0 ? 4 : 2 * list->capacity;
+		list->watches = realloc(list->watches, list->capacity * sizeof(Watch));
+	}
+	list->watches[list->size].clause = clause;
+	list->watches[list->size++].blocker = blocker;
+}
+
+/**
+ * Watches the first 2 literals of a clause.
+ */
+static void _attachClause(SatSolver * satSolver, Clause * clause) {
+	_appendWatch(&satSolver->watches[clause->literals[0]], clause, clause->literals[1]);
+	_appendWatch(&satSolver->watches[clause->literals[1]], clause, clause->literals[0]);
+}
+
+/**
+ * Undoes every assignment above a decision level, saving the phases.
+ */
+static void _backtrack(SatSolver * satSolver, const unsigned int level) {
+	if (satSolver->decisionLevel <= level) {
+		return;
+	}
+	for (unsigned int k = satSolver->trailSize; satSolver->trailLimits[level] < k; --k) {
+		const Lit literal = satSolver->trail[k - 1];
+		const unsigned int variable = literal >> 1;
+		satSolver->values[variable] = UNASSIGNED;
+		satSolver->reasons[variable] = NULL;
+		satSolver->phases[variable] = (literal & 1) == 0;
+		_heapInsert(satSolver, variable);
+	}
+	satSolver->trailSize = satSolver->trailLimits[level];
+	satSolver->propagationHead = satSolver->trailSize;
+	satSolver->decisionLevel = level;
+}
+
+/**
+ * Increases the activity of a learnt clause, rescaling every activity if
+ * they become too large.
+ */
+static void _bumpClause(SatSolver * satSolver, Clause * clause) {
+	clause->activity += satSolver->clauseIncrement;
+	if (1e20 < clause->activity) {
+		for (unsigned int k = 0; k < satSolver->learnts.size; ++k) {
+			satSolver->learnts.clauses[k]->activity *= 1e-20;
+		}
+		satSolver->clauseIncrement *= 1e-20;
+	}
+}
+
+/**
+ * Increases the activity of a variable, rescaling every activity if they
+ * become too large.
+ */
+static void _bumpVariable(SatSolver * satSolver, const unsigned int variable) {
+	satSolver->activities[variable] += satSolver->variableIncrement;
+	if (1e100 < satSolver->activities[variable]) {
+		for (unsigned int k = 0; k < satSolver->variableCount; ++k) {
+			satSolver->activities[k] *= 1e-100;
+		}
+		satSolver->variableIncrement *= 1e-100;
+	}
+	if (0 <= satSolver->heapPositions[variable]) {
+		_heapSiftUp(satSolver, satSolver->heapPositions[variable]);
+	}
+}
+
+/**
+ * Orders the learnt clauses from the least to the most useful: first by
+ * glue (descending), and then by activity.
+ */
+static int _compareLearnts(const void * left, const void * right) {
+	const Clause * leftClause = *(const Clause **) left;
+	const Clause * rightClause = *(const Clause **) right;
+	if (leftClause->glue != rightClause->glue) {
+		return leftClause->glue < rightClause->glue ? 1 : -1;
+	}
+	return (leftClause->activity > rightClause->activity) - (leftClause->activity < rightClause->activity);
+}
+
+/**
+ * Creates a new clause (using heap-memory).
+ */
+static Clause * _createClause(const Lit * literals, const unsigned int size, const boolean learnt) {
+	Clause * clause = malloc(sizeof(Clause) + size * sizeof(Lit));
+	clause->learnt = learnt;
+	clause->deleted = false;
+	clause->size = size;
+	clause->glue = size;
+	clause->activity = 0;
+	memcpy(clause->literals, literals, size * sizeof(Lit));
+	return clause;
+}
+
+/**
+ * Assigns a literal at the current decision level.
+ */
+static void _enqueue(SatSolver * satSolver, const Lit literal, Clause * reason) {
+	const unsigned int variable = literal >> 1;
+	satSolver->values[variable] = (literal & 1) == 0;
+	satSolver->levels[variable] = satSolver->decisionLevel;
+	satSolver->reasons[variable] = reason;
+	satSolver->trail[satSolver->trailSize++] = literal;
+}
+
+/**
+ * Inserts a variable in the heap, unless it's already there.
+ */
+static void _heapInsert(SatSolver * satSolver, const unsigned int variable) {
+	if (0 <= satSolver->heapPositions[variable]) {
+		return;
+	}
+	satSolver->heap[satSolver->heapSize] = variable;
+	satSolver->heapPositions[variable] = satSolver->heapSize;
+	_heapSiftUp(satSolver, satSolver->heapSize++);
+}
+
+/**
+ * Removes the most active variable of the heap.
+ */
+static unsigned int _heapPop(SatSolver * satSolver) {
+	const unsigned int variable = satSolver->heap[0];
+	satSolver->heapPositions[variable] = -1;
+	if (0 < --satSolver->heapSize) {
+		satSolver->heap[0] = satSolver->heap[satSolver->heapSize];
+		satSolver->heapPositions[satSolver->heap[0]] = 0;
+		_heapSiftDown(satSolver, 0);
+	}
+	return variable;
+}
+
+static void _heapSiftDown(SatSolver * satSolver, unsigned int position) {
+	const unsigned int variable = satSolver->heap[position];
+	while (2 * position + 1 < satSolver->heapSize) {
+		unsigned int child = 2 * position + 1;
+		if (child + 1 < satSolver->heapSize
+			&& satSolver->activities[satSolver->heap[child]] < satSolver->activities[satSolver->heap[child + 1]]) {
+			++child;
+		}
+		if (satSolver->activities[satSolver->heap[child]] <= satSolver->activities[variable]) {
+			break;
+		}
+		satSolver->heap[position] = satSolver->heap[child];
+		satSolver->heapPositions[satSolver->heap[position]] = position;
+		position = child;
+	}
+	satSolver->heap[position] = variable;
+	satSolver->heapPositions[variable] = position;
+}
+
+static void _heapSiftUp(SatSolver * satSolver, unsigned int position) {
+	const unsigned int variable = satSolver->heap[position];
+	while (0 < position) {
+		const unsigned int parent = (position - 1) / 2;
+		if (satSolver->activities[variable] <= satSolver->activities[satSolver->heap[parent]]) {
+			break;
+		}
+		satSolver->heap[position] = satSolver->heap[parent];
+		satSolver->heapPositions[satSolver->heap[position]] = position;
+		position = parent;
+	}
+	satSolver->heap[position] = variable;
+	satSolver->heapPositions[variable] = position;
+}
+
+/**
+ * Returns true if the clause is the reason of a current assignment (so it
+ * cannot be deleted).
+ */
+static boolean _isLocked(const SatSolver * satSolver, const Clause * clause) {
+	const unsigned int variable = clause->literals[0] >> 1;
+	return satSolver->reasons[variable] == clause && _literalValue(satSolver, clause->literals[0]) == true;
+}
+
+/**
+ * Returns true if a literal of the learnt clause is implied by the other
+ * ones (i.e., every literal of its reason is already in the clause, or was
+ * assigned at the level 0).
+ */
+static boolean _isRedundant(SatSolver * satSolver, const Lit literal) {
+	const Clause * reason = satSolver->reasons[literal >> 1];
+	if (reason == NULL) {
+		return false;
+	}
+	for (unsigned int k = 1; k < reason->size; ++k) {
+		const unsigned int variable = reason->literals[k] >> 1;
+		if (!satSolver->seen[variable] && 0 < satSolver->levels[variable]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * The amount of distinct decision levels of the literals of a clause, a
+ * measure of its usefulness (the lower, the better).
+ */
+static unsigned int _glue(SatSolver * satSolver, const Lit * literals, const unsigned int size) {
+	++satSolver->levelStamp;
+	unsigned int glue = 0;
+	for (unsigned int k = 0; k < size; ++k) {
+		const unsigned int level = satSolver->levels[literals[k] >> 1];
+		if (satSolver->levelStamps[level] != satSolver->levelStamp) {
+			satSolver->levelStamps[level] = satSolver->levelStamp;
+			++glue;
+		}
+	}
+	return glue;
+}
+
+/**
+ * The value of a literal: true, false or UNASSIGNED.
+ */
+static signed char _literalValue(const SatSolver * satSolver, const Lit literal) {
+	const signed char value = satSolver->values[literal >> 1];
+	return value == UNASSIGNED ? UNASSIGNED : (signed char) (value ^ (literal & 1));
+}
+
+/**
+ * The element of the Luby sequence (1, 1, 2, 1, 1, 2, 4, ...) at an index.
+ */
+static uint64_t _luby(uint64_t index) {
+	uint64_t size = 1;
+	unsigned int sequence = 0;
+	while (size < index + 1) {
+		++sequence;
+		size = 2 * size + 1;
+	}
+	while (size - 1 != index) {
+		size = (size - 1) >> 1;
+		--sequence;
+		index = index % size;
+	}
+	return 1ull << sequence;
+}
+
+/**
+ * Propagates every pending assignment through the watched literals, and
+ * returns the conflicting clause, if any.
+ */
+static Clause * _propagate(SatSolver * satSolver) {
+	Clause * conflict = NULL;
+	while (conflict == NULL && satSolver->propagationHead < satSolver->trailSize) {
+		const Lit falseLiteral = satSolver->trail[satSolver->propagationHead++] ^ 1;
+		WatchList * watches = &satSolver->watches[falseLiteral];
+		++satSolver->statistics.propagations;
+		unsigned int read = 0;
+		unsigned int write = 0;
+		while (read < watches->size) {
+			const Watch watch = watches->watches[read++];
+			if (_literalValue(satSolver, watch.blocker) == true) {
+				watches->watches[write++] = watch;
+				continue;
+			}
+			Clause * clause = watch.clause;
+			Lit * literals = clause->literals;
+			if (literals[0] == falseLiteral) {
+				literals[0] = literals[1];
+				literals[1] = falseLiteral;
+			}
+			if (literals[0] != watch.blocker && _literalValue(satSolver, literals[0]) == true) {
+				watches->watches[write].clause = clause;
+				watches->watches[write++].blocker = literals[0];
+				continue;
+			}
+			boolean moved = false;
+			for (unsigned int k = 2; k < clause->size; ++k) {
+				if (_literalValue(satSolver, literals[k]) != false) {
+					literals[1] = literals[k];
+					literals[k] = falseLiteral;
+					_appendWatch(&satSolver->watches[literals[1]], clause, literals[0]);
+					moved = true;
+					break;
+				}
+			}
+			if (moved) {
+				continue;
+			}
+			watches->watches[write].clause = clause;
+			watches->watches[write++].blocker = literals[0];
+			if (_literalValue(satSolver, literals[0]) == false) {
+				conflict = clause;
+				while (read < watches->size) {
+					watches->watches[write++] = watches->watches[read++];
+				}
+			}
+			else {
+				_enqueue(satSolver, literals[0], clause);
+			}
+		}
+		watches->size = write;
+	}
+	return conflict;
+}
+
+/**
+ * Deletes the least useful half of the learnt clauses, except the binary
+ * ones, the ones with glue 2, and the reasons of current assignments.
+ */
+static void _reduceLearnts(SatSolver * satSolver) {
+	ClauseList * learnts = &satSolver->learnts;
+	qsort(learnts->clauses, learnts->size, sizeof(Clause *), _compareLearnts);
+	Clause ** deleted = malloc(learnts->size * sizeof(Clause *));
+	unsigned int deletedCount = 0;
+	unsigned int kept = 0;
+	for (unsigned int k = 0; k < learnts->size; ++k) {
+		Clause * clause = learnts->clauses[k];
+		if (k < learnts->size / 2 && 2 < clause->size && 2 < clause->glue && !_isLocked(satSolver, clause)) {
+			clause->deleted = true;
+			deleted[deletedCount++] = clause;
+		}
+		else {
+			learnts->clauses[kept++] = clause;
+		}
+	}
+	for (unsigned int literal = 0; literal < 2 * satSolver->variableCount; ++literal) {
+		WatchList * watches = &satSolver->watches[literal];
+		unsigned int write = 0;
+		for (unsigned int read = 0; read < watches->size; ++read) {
+			if (!watches->watches[read].clause->deleted) {
+				watches->watches[write++] = watches->watches[read];
+			}
+		}
+		watches->size = write;
+	}
+	for (unsigned int k = 0; k < deletedCount; ++k) {
+		free(deleted[k]);
+	}
+	free(deleted);
+	satSolver->statistics.deletedClauses += deletedCount;
+	learnts->size = kept;
+	satSolver->maxLearnts *= MAX_LEARNT_CLAUSES_GROWTH;
+}
+
+/**
+ * Converts a DIMACS literal into an internal one.
+ */
+static Lit _toLit(const Literal literal) {
+	return 0 < literal ? 2 * (literal - 1) : 2 * (-literal - 1) + 1;
+}
+
+/* PUBLIC FUNCTIONS */
+
+SatSolver * createSatSolver() {
+	SatSolver * satSolver = calloc(1, sizeof(SatSolver));
+	satSolver->consistent = true;
+	satSolver->maxLearnts = INITIAL_MAX_LEARNT_CLAUSES;
+	satSolver->variableIncrement = 1;
+	satSolver->clauseIncrement = 1;
+	return satSolver;
+}
+
+void destroySatSolver(SatSolver * satSolver) {
+	if (satSolver == NULL) {
+		return;
+	}
+	for (unsigned int k = 0; k < satSolver->clauses.size; ++k) {
+		free(satSolver->clauses.clauses[k]);
+	}
+	for (unsigned int k = 0; k < satSolver->learnts.size; ++k) {
+		free(satSolver->learnts.clauses[k]);
+	}
+	for (unsigned int literal = 0; literal < 2 * satSolver->variableCapacity; ++literal) {
+		free(satSolver->watches[literal].watches);
+	}
+	free(satSolver->clauses.clauses);
+	free(satSolver->learnts.clauses);
+	free(satSolver->watches);
+	free(satSolver->values);
+	free(satSolver->levels);
+	free(satSolver->reasons);
+	free(satSolver->phases);
+	free(satSolver->trail);
+	free(satSolver->trailLimits);
+	free(satSolver->activities);
+	free(satSolver->heap);
+	free(satSolver->heapPositions);
+	free(satSolver->seen);
+	free(satSolver->learnt);
+	free(satSolver->levelStamps);
+	free(satSolver->model);
+	free(satSolver);
+}
+
+Literal newSatVariable(SatSolver * satSolver) {
+	const unsigned int variable = satSolver->variableCount++;
+	if (variable == satSolver->variableCapacity) {
+		const unsigned int previous = satSolver->variableCapacity;
+		const unsigned int capacity = previous == 0 ? 64 : 2 * previous;
+		satSolver->watches = realloc(satSolver->watches, 2 * capacity * sizeof(WatchList));
+		memset(&satSolver->watches[2 * previous], 0, 2 * (capacity - previous) * sizeof(WatchList));
+		satSolver->values = realloc(satSolver->values, capacity * sizeof(signed char));
+		satSolver->levels = realloc(satSolver->levels, capacity * sizeof(unsigned int));
+		satSolver->reasons = realloc(satSolver->reasons, capacity * sizeof(Clause *));
+		satSolver->phases = realloc(satSolver->phases, capacity * sizeof(boolean));
+		satSolver->trail = realloc(satSolver->trail, capacity * sizeof(Lit));
+		satSolver->trailLimits = realloc(satSolver->trailLimits, (1 + capacity) * sizeof(unsigned int));
+		satSolver->activities = realloc(satSolver->activities, capacity * sizeof(double));
+		satSolver->heap = realloc(satSolver->heap, capacity * sizeof(unsigned int));
+		satSolver->heapPositions = realloc(satSolver->heapPositions, capacity * sizeof(int));
+		satSolver->seen = realloc(satSolver->seen, capacity * sizeof(boolean));
+		satSolver->learnt = realloc(satSolver->learnt, (1 + capacity) * sizeof(Lit));
+		satSolver->levelStamps = realloc(satSolver->levelStamps, (1 + capacity) * sizeof(unsigned int));
+		memset(&satSolver->levelStamps[previous], 0, (1 + capacity - previous) * sizeof(unsigned int));
+		satSolver->model = realloc(satSolver->model, capacity * sizeof(boolean));
+		satSolver->variableCapacity = capacity;
+	}
+	satSolver->values[variable] = UNASSIGNED;
+	satSolver->levels[variable] = 0;
+	satSolver->reasons[variable] = NULL;
+	satSolver->phases[variable] = false;
+	satSolver->activities[variable] = 0;
+	satSolver->heapPositions[variable] = -1;
+	satSolver->seen[variable] = false;
+	satSolver->model[variable] = false;
+	_heapInsert(satSolver, variable);
+	return variable + 1;
+}
+
+unsigned int satVariableCount(const SatSolver * satSolver) {
+	return satSolver->variableCount;
+}
+
+boolean addSatClause(SatSolver * satSolver, const Literal * literals, const unsigned int count) {
+	if (!satSolver->consistent) {
+		return false;
+	}
+	// Removes the duplicated and false literals (at level 0), and drops the
+	// clause if it's satisfied or tautological.
+	Lit * clause = satSolver->learnt;
+	if (satSolver->variableCapacity < count) {
+		clause = malloc(count * sizeof(Lit));
+	}
+	unsigned int size = 0;
+	boolean satisfied = false;
+	for (unsigned int k = 0; k < count && !satisfied; ++k) {
+		const Lit literal = _toLit(literals[k]);
+		const signed char value = _literalValue(satSolver, literal);
+		boolean duplicated = false;
+		for (unsigned int j = 0; j < size; ++j) {
+			satisfied = satisfied || clause[j] == (literal ^ 1);
+			duplicated = duplicated || clause[j] == literal;
+		}
+		satisfied = satisfied || value == true;
+		if (!duplicated && value == UNASSIGNED) {
+			clause[size++] = literal;
+		}
+	}
+	if (!satisfied) {
+		if (size == 0) {
+			satSolver->consistent = false;
+		}
+		else if (size == 1) {
+			_enqueue(satSolver, clause[0], NULL);
+			satSolver->consistent = _propagate(satSolver) == NULL;
+		}
+		else {
+			Clause * newClause = _createClause(clause, size, false);
+			_appendClause(&satSolver->clauses, newClause);
+			_attachClause(satSolver, newClause);
+		}
+	}
+	if (clause != satSolver->learnt) {
+		free(clause);
+	}
+	return satSolver->consistent;
+}
+
+SatResult solveSat(SatSolver * satSolver) {
+	return solveSatAssuming(satSolver, NULL, 0);
+}
+
+SatResult solveSatAssuming(SatSolver * satSolver, const Literal * assumptions, const unsigned int count) {
+	if (!satSolver->consistent || _propagate(satSolver) != NULL) {
+		satSolver->consistent = false;
+		return UNSATISFIABLE;
+	}
+	uint64_t restartConflicts = RESTART_UNIT * _luby(satSolver->statistics.restarts);
+	uint64_t conflicts = 0;
+	while (true) {
+		Clause * conflict = _propagate(satSolver);
+		if (conflict != NULL) {
+			++satSolver->statistics.conflicts;
+			++conflicts;
+			if (satSolver->decisionLevel == 0) {
+				satSolver->consistent = false;
+				return UNSATISFIABLE;
+			}
+			unsigned int size = 0;
+			unsigned int backtrackLevel = 0;
+			_analyze(satSolver, conflict, &size, &backtrackLevel);
+			_backtrack(satSolver, backtrackLevel);
+			if (size == 1) {
+				_enqueue(satSolver, satSolver->learnt[0], NULL);
+			}
+			else {
+				Clause * learnt = _createClause(satSolver->learnt, size, true);
+				learnt->glue = _glue(satSolver, learnt->literals, size);
+				_appendClause(&satSolver->learnts, learnt);
+				_attachClause(satSolver, learnt);
+				_bumpClause(satSolver, learnt);
+				_enqueue(satSolver, learnt->literals[0], learnt);
+				++satSolver->statistics.learntClauses;
+			}
+			satSolver->variableIncrement /= VARIABLE_ACTIVITY_DECAY;
+			satSolver->clauseIncrement /= CLAUSE_ACTIVITY_DECAY;
+			continue;
+		}
+		if (restartConflicts <= conflicts) {
+			_backtrack(satSolver, 0);
+			++satSolver->statistics.restarts;
+			restartConflicts = RESTART_UNIT * _luby(satSolver->statistics.restarts);
+			conflicts = 0;
+		}
+		if (satSolver->maxLearnts + satSolver->trailSize <= satSolver->learnts.size) {
+			_reduceLearnts(satSolver);
+		}
+		// The assumptions are the first decisions: the first one that isn't
+		// true yet is decided (there's no level for the ones that are implied
+		// by the previous ones).
+		Lit decision = NO_LITERAL;
+		for (unsigned int k = 0; k < count && decision == NO_LITERAL; ++k) {
+			const Lit assumption = _toLit(assumptions[k]);
+			const signed char value = _literalValue(satSolver, assumption);
+			if (value == false) {
+				_backtrack(satSolver, 0);
+				return UNSATISFIABLE;
+			}
+			if (value == UNASSIGNED) {
+				decision = assumption;
+			}
+		}
+		if (decision != NO_LITERAL) {
+			++satSolver->statistics.decisions;
+			satSolver->trailLimits[satSolver->decisionLevel++] = satSolver->trailSize;
+			_enqueue(satSolver, decision, NULL);
+			continue;
+		}
+		unsigned int variable = UINT_MAX;
+		while (0 < satSolver->heapSize && variable == UINT_MAX) {
+			const unsigned int candidate = _heapPop(satSolver);
+			if (satSolver->values[candidate] == UNASSIGNED) {
+				variable = candidate;
+			}
+		}
+		if (variable == UINT_MAX) {
+			for (unsigned int k = 0; k < satSolver->variableCount; ++k) {
+				satSolver->model[k] = satSolver->values[k] == true;
+			}
+			_backtrack(satSolver, 0);
+			return SATISFIABLE;
+		}
+		++satSolver->statistics.decisions;
+		satSolver->trailLimits[satSolver->decisionLevel++] = satSolver->trailSize;
+		_enqueue(satSolver, 2 * variable + (satSolver->phases[variable] ? 0 : 1), NULL);
+	}
+}
+
+boolean satModelValue(const SatSolver * satSolver, const Literal variable) {
+	return satSolver->model[variable - 1];
+}
+
+const SatStatistics * satStatistics(const SatSolver * satSolver) {
+	return &satSolver->statistics;
+}
@@ -0,0 +1,98 @@
+#ifndef SAT_SOLVER_HEADER
+#define SAT_SOLVER_HEADER
+
+#include "../../shared/Logger.h"
+#include "../../shared/Type.h"
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Initialize module's internal state. */
+void initializeSatSolverModule();
+
+/** Shutdown module's internal state. */
+void shutdownSatSolverModule();
+
+/**
+ * A literal, as in the DIMACS format: the variable "v" (starting at 1) is the
+ * literal "v", and its negation is "-v".
+ */
+typedef int Literal;
+
+typedef enum {
+	SATISFIABLE,
+	UNSATISFIABLE
+} SatResult;
+
+/**
+ * The counters of a solver, accumulated across every call to "solve".
+ */
+typedef struct {
+	uint64_t conflicts;
+	uint64_t decisions;
+	uint64_t propagations;
+	uint64_t restarts;
+	uint64_t learntClauses;
+	uint64_t deletedClauses;
+} SatStatistics;
+
+typedef struct SatSolver SatSolver;
+
+/**
+ * Creates a new solver, without variables nor clauses.
+ */
+SatSolver * createSatSolver();
+
+/**
+ * Destroy a solver, and every clause it holds.
+ */
+void destroySatSolver(SatSolver * satSolver);
+
+/**
+ * Creates a new variable, and returns it (as a positive literal).
+ */
+Literal newSatVariable(SatSolver * satSolver);
+
+/**
+ * The amount of variables of the solver.
+ */
+unsigned int satVariableCount(const SatSolver * satSolver);
+
+/**
+ * Adds a clause (the disjunction of the literals), whose variables must exist
+ * already. Clauses can be added between calls to "solve", and every learnt
+ * clause remains valid. Returns false if the solver became trivially
+ * unsatisfiable.
+ */
+boolean addSatClause(SatSolver * satSolver, const Literal * literals, const unsigned int count);
+
+/**
+ * Decides the satisfiability of the conjunction of every clause, with a
+ * conflict-driven clause-learning search: two watched literals per clause,
+ * VSIDS decisions with phase saving, Luby restarts, and periodic deletion of
+ * the least active learnt clauses.
+ */
+SatResult solveSat(SatSolver * satSolver);
+
+/**
+ * Analog to "solveSat", but under some assumptions: literals that are taken
+ * as true only during this call, as the first decisions of the search. An
+ * unsatisfiable result only holds under the assumptions, and every clause
+ * learnt remains valid without them, so a solver can answer many queries
+ * over the same clauses, each one faster than the previous ones.
+ */
+SatResult solveSatAssuming(SatSolver * satSolver, const Literal * assumptions, const unsigned int count);
+
+/**
+ * The value of a variable in the model found by the last satisfiable call to
+ * "solveSat".
+ */
+boolean satModelValue(const SatSolver * satSolver, const Literal variable);
+
+/**
+ * The counters of the solver.
+ */
+const SatStatistics * satStatistics(const SatSolver * satSolver);
+
+#endif
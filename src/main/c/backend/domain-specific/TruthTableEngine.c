@@ -0,0 +1,539 @@
+#include "TruthTableEngine.h"
+#include "TruthTableKernel.h"
+
+/* MODULE INTERNAL STATE */
+
+#define UNVISITED UINT_MAX
+
+/**
+ * The amount of tiles of every batch of "enumerateModels", per thread.
+ */
+#define BATCH_TILES_PER_THREAD 8
+
+/**
+ * The size of the blocks of the arena of a compiled formula. Most formulas
+ * are small, and an execution keeps every compiled formula alive, so a block
+ * of the default size would dominate the memory of each one (the large
+ * arrays get dedicated blocks anyway).
+ */
+#define COMPILED_FORMULA_BLOCK_SIZE 1024
+
+static Logger * _logger = NULL;
+static ThreadPool * _threadPool = NULL;
+
+// The scratch tables of the compilation, by node of the DAG and by identifier
+// ID, which grow with them. Only the entries of the compiled formula are
+// restored after each compilation, so it takes time linear in the formula
+// (not in the DAG, which holds every formula of the program).
+static unsigned int * _registers = NULL;
+static unsigned int _registerCapacity = 0;
+static unsigned int * _columns = NULL;
+static unsigned int _columnCapacity = 0;
+
+void initializeTruthTableEngineModule() {
+	_logger = createLogger("TruthTableEngine");
+	const long processors = sysconf(_SC_NPROCESSORS_ONLN);
+	const int threads = getIntegerOrDefault("TRUTH_TABLE_THREADS", processors < 1 ? 1 : (int) processors);
+	_threadPool = createThreadPool(threads < 1 ? 1 : threads);
+	logDebugging(_logger, "Enumerating valuations with %u threads.", threadPoolSize(_threadPool));
+}
+
+void shutdownTruthTableEngineModule() {
+	destroyThreadPool(_threadPool);
+	free(_registers);
+	free(_columns);
+	_registers = NULL;
+	_columns = NULL;
+	_registerCapacity = 0;
+	_columnCapacity = 0;
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/**
+ * The state of the compilation of a formula.
+ */
+typedef struct {
+	const SymbolTable * symbolTable;
+	const FormulaDag * formulaDag;
+	CompiledFormula * compiledFormula;
+
+	// The program being built (in heap-memory, until it's done).
+	Instruction * instructions;
+	unsigned int instructionCount;
+	unsigned int instructionCapacity;
+
+	// The columns, in order of appearance, and the register that loads each
+	// (sized by the support of the formula).
+	const Identifier ** variables;
+	unsigned int * loads;
+	unsigned int variableCount;
+
+	// The column of each variable, by identifier ID.
+	unsigned int * columns;
+
+	// The register of each node of the DAG, plus one (0 if the node wasn't
+	// compiled yet), and the nodes compiled so far.
+	unsigned int * registers;
+	unsigned int * nodes;
+	unsigned int nodeCount;
+	unsigned int nodeCapacity;
+} Builder;
+
+/**
+ * A parallel enumeration of the valuations of a formula, by tiles. Every
+ * worker has its own scratch memory.
+ */
+typedef struct {
+	const CompiledFormula * compiledFormula;
+	const TruthTableKernel * kernel;
+	unsigned int tileWords;
+	uint64_t lanes;
+	uint64_t ** scratches;
+	uint64_t * results;
+
+	// Only for "enumerateModels": the first tile of the current batch.
+	uint64_t firstTile;
+
+	// Only for "classifyFormula" (updated atomically).
+	int satisfiable;
+	int falsifiable;
+} Enumeration;
+
+/**
+ * A node of the DAG waiting to be compiled, which is expanded once its
+ * operands are in the stack.
+ */
+typedef struct {
+	unsigned int node;
+	boolean expanded;
+} CompilationFrame;
+
+/**
+ * A column, and its key to sort the columns by order of declaration.
+ */
+typedef struct {
+	unsigned int column;
+	unsigned int key;
+} ColumnKey;
+
+/* PRIVATE FUNCTIONS */
+
+static uint64_t _applyOperator(const OperatorTable * operator, const unsigned int * arguments, const uint64_t * registers);
+static void _beginEnumeration(Enumeration * enumeration, const CompiledFormula * compiledFormula, const unsigned int resultTiles);
+static void _classifyTile(const uint64_t tile, const unsigned int worker, void * context);
+static int _compareColumnKeys(const void * left, const void * right);
+static void _compileNodes(Builder * builder, const unsigned int root);
+static void _endEnumeration(Enumeration * enumeration);
+static void _enumerateTile(const uint64_t tile, const unsigned int worker, void * context);
+static unsigned int _emit(Builder * builder, const Opcode opcode, const unsigned int left, const unsigned int right);
+static unsigned int _loadVariable(Builder * builder, const Identifier * variable);
+static uint64_t _run(const CompiledFormula * compiledFormula, const uint64_t * columns, uint64_t * registers);
+static void _sortColumns(Builder * builder);
+static uint64_t _validLanes(const CompiledFormula * compiledFormula);
+
+/**
+ * Applies a custom operator to 64 inputs at once, with the smaller of its
+ * covers (negating the image if it's the cover of false).
+ */
+static uint64_t _applyOperator(const OperatorTable * operator, const unsigned int * arguments, const uint64_t * registers) {
+	const boolean negated = operator->falseCover->count < operator->trueCover->count;
+	const CubeCover * cover = negated ? operator->falseCover : operator->trueCover;
+	uint64_t image = 0;
+	for (unsigned int c = 0; c < cover->count; ++c) {
+		const Cube cube = cover->cubes[c];
+		uint64_t lanes = ~0ull;
+		for (uint64_t care = cube.care; care != 0; care &= care - 1) {
+			const unsigned int k = __builtin_ctzll(care);
+			lanes &= ((cube.values >> k) & 1) ? registers[arguments[k]] : ~registers[arguments[k]];
+		}
+		image |= lanes;
+	}
+	return negated ? ~image : image;
+}
+
+/**
+ * Prepares the enumeration of a formula, with room for the specified amount
+ * of tiles of results.
+ */
+static void _beginEnumeration(Enumeration * enumeration, const CompiledFormula * compiledFormula, const unsigned int resultTiles) {
+	const unsigned int threads = threadPoolSize(_threadPool);
+	enumeration->compiledFormula = compiledFormula;
+	enumeration->kernel = truthTableKernel(compiledFormula);
+	enumeration->tileWords = truthTableTileWords(enumeration->kernel, compiledFormula);
+	enumeration->lanes = _validLanes(compiledFormula);
+	enumeration->scratches = calloc(threads, sizeof(uint64_t *));
+	for (unsigned int k = 0; k < threads; ++k) {
+		enumeration->scratches[k] = allocateKernelScratch(compiledFormula, enumeration->tileWords);
+	}
+	enumeration->results = calloc((size_t) resultTiles * enumeration->tileWords, sizeof(uint64_t));
+	enumeration->firstTile = 0;
+	enumeration->satisfiable = 0;
+	enumeration->falsifiable = 0;
+}
+
+/**
+ * Evaluates a tile for "classifyFormula", and cancels the rest of them once
+ * the formula is known to be a contingency. Each worker writes the results
+ * in its own tile.
+ */
+static void _classifyTile(const uint64_t tile, const unsigned int worker, void * context) {
+	Enumeration * enumeration = context;
+	uint64_t * results = &enumeration->results[worker * enumeration->tileWords];
+	enumeration->kernel->function(enumeration->compiledFormula, tile * enumeration->tileWords, enumeration->tileWords,
+		enumeration->scratches[worker], results);
+	boolean satisfiable = false;
+	boolean falsifiable = false;
+	for (unsigned int word = 0; word < enumeration->tileWords; ++word) {
+		const uint64_t result = results[word] & enumeration->lanes;
+		satisfiable = satisfiable || result != 0;
+		falsifiable = falsifiable || result != enumeration->lanes;
+	}
+	if (satisfiable) {
+		__atomic_store_n(&enumeration->satisfiable, 1, __ATOMIC_RELAXED);
+	}
+	if (falsifiable) {
+		__atomic_store_n(&enumeration->falsifiable, 1, __ATOMIC_RELAXED);
+	}
+	if (__atomic_load_n(&enumeration->satisfiable, __ATOMIC_RELAXED) && __atomic_load_n(&enumeration->falsifiable, __ATOMIC_RELAXED)) {
+		cancelChunks(_threadPool);
+	}
+}
+
+/**
+ * Compares two column keys, for "qsort".
+ */
+static int _compareColumnKeys(const void * left, const void * right) {
+	const unsigned int leftKey = ((const ColumnKey *) left)->key;
+	const unsigned int rightKey = ((const ColumnKey *) right)->key;
+	return (leftKey > rightKey) - (leftKey < rightKey);
+}
+
+/**
+ * Compiles the nodes of the DAG below a root that were not compiled yet, in
+ * post-order (the operands from left to right), with an explicit stack of
+ * nodes. A node is expanded the first time it's on top, and it's compiled the
+ * next time, once its operands have registers.
+ */
+static void _compileNodes(Builder * builder, const unsigned int root) {
+	unsigned int capacity = 64;
+	unsigned int size = 0;
+	CompilationFrame * stack = malloc(capacity * sizeof(CompilationFrame));
+	stack[size++] = (CompilationFrame) {.node = root, .expanded = false};
+	while (0 < size) {
+		CompilationFrame * frame = &stack[size - 1];
+		const unsigned int node = frame->node;
+		if (builder->registers[node] != 0) {
+			--size;
+			continue;
+		}
+		const DagNode current = dagNode(builder->formulaDag, node);
+		if (!frame->expanded && current.opcode != LOAD_VARIABLE) {
+			frame->expanded = true;
+			const unsigned int operandCount = dagOperandCount(&current);
+			if (capacity < size + operandCount) {
+				capacity = 2 * (size + operandCount);
+				stack = realloc(stack, capacity * sizeof(CompilationFrame));
+			}
+			for (unsigned int k = operandCount; 0 < k; --k) {
+				stack[size++] = (CompilationFrame) {.node = dagOperand(&current, k - 1), .expanded = false};
+			}
+			continue;
+		}
+		--size;
+		unsigned int result = 0;
+		switch (current.opcode) {
+			case LOAD_VARIABLE:
+				result = _loadVariable(builder, current.variable);
+				break;
+			case NOT_OPERATION:
+				result = _emit(builder, NOT_OPERATION, builder->registers[current.left] - 1, 0);
+				break;
+			case CUSTOM_OPERATION: {
+				const OperatorTable * operator = current.operator;
+				unsigned int * arguments = allocateInArena(builder->compiledFormula->arena, operator->arity, sizeof(unsigned int));
+				for (unsigned int k = 0; k < operator->arity; ++k) {
+					arguments[k] = builder->registers[current.arguments[k]] - 1;
+				}
+				result = _emit(builder, CUSTOM_OPERATION, 0, 0);
+				builder->instructions[result].operator = operator;
+				builder->instructions[result].arguments = arguments;
+				break;
+			}
+			default:
+				result = _emit(builder, current.opcode, builder->registers[current.left] - 1, builder->registers[current.right] - 1);
+				break;
+		}
+		builder->registers[node] = 1 + result;
+		if (builder->nodeCount == builder->nodeCapacity) {
+			builder->nodeCapacity = builder->nodeCapacity == 0 ? 64 : 2 * builder->nodeCapacity;
+			builder->nodes = realloc(builder->nodes, builder->nodeCapacity * sizeof(unsigned int));
+		}
+		builder->nodes[builder->nodeCount++] = node;
+	}
+	free(stack);
+}
+
+/**
+ * Releases the resources of an enumeration.
+ */
+static void _endEnumeration(Enumeration * enumeration) {
+	for (unsigned int k = 0; k < threadPoolSize(_threadPool); ++k) {
+		free(enumeration->scratches[k]);
+	}
+	free(enumeration->scratches);
+	free(enumeration->results);
+}
+
+/**
+ * Evaluates a tile of the current batch of "enumerateModels", writing the
+ * results in the position of the tile inside the batch.
+ */
+static void _enumerateTile(const uint64_t tile, const unsigned int worker, void * context) {
+	Enumeration * enumeration = context;
+	enumeration->kernel->function(enumeration->compiledFormula, (enumeration->firstTile + tile) * enumeration->tileWords,
+		enumeration->tileWords, enumeration->scratches[worker], &enumeration->results[tile * enumeration->tileWords]);
+}
+
+/**
+ * Appends a new instruction, and returns its register.
+ */
+static unsigned int _emit(Builder * builder, const Opcode opcode, const unsigned int left, const unsigned int right) {
+	if (builder->instructionCount == builder->instructionCapacity) {
+		builder->instructionCapacity = builder->instructionCapacity == 0 ? 64 : 2 * builder->instructionCapacity;
+		builder->instructions = realloc(builder->instructions, builder->instructionCapacity * sizeof(Instruction));
+	}
+	Instruction * instruction = &builder->instructions[builder->instructionCount];
+	instruction->opcode = opcode;
+	instruction->left = left;
+	instruction->right = right;
+	instruction->operator = NULL;
+	instruction->arguments = NULL;
+	return builder->instructionCount++;
+}
+
+/**
+ * Returns the register that loads a variable, assigning it a new column the
+ * first time.
+ */
+static unsigned int _loadVariable(Builder * builder, const Identifier * variable) {
+	const unsigned int column = builder->columns[variable->id];
+	if (column != UNVISITED) {
+		return builder->loads[column];
+	}
+	builder->columns[variable->id] = builder->variableCount;
+	builder->variables[builder->variableCount] = variable;
+	builder->loads[builder->variableCount] = _emit(builder, LOAD_VARIABLE, builder->variableCount, 0);
+	return builder->loads[builder->variableCount++];
+}
+
+/**
+ * Runs the program of a formula over a word of 64 valuations, with the
+ * specified columns (i.e., without a kernel).
+ */
+static uint64_t _run(const CompiledFormula * compiledFormula, const uint64_t * columns, uint64_t * registers) {
+	const Instruction * instructions = compiledFormula->instructions;
+	for (unsigned int k = 0; k < compiledFormula->instructionCount; ++k) {
+		const Instruction * instruction = &instructions[k];
+		switch (instruction->opcode) {
+			case LOAD_VARIABLE:
+				registers[k] = columns[instruction->left];
+				break;
+			case NOT_OPERATION:
+				registers[k] = ~registers[instruction->left];
+				break;
+			case AND_OPERATION:
+				registers[k] = registers[instruction->left] & registers[instruction->right];
+				break;
+			case OR_OPERATION:
+				registers[k] = registers[instruction->left] | registers[instruction->right];
+				break;
+			case THEN_OPERATION:
+				registers[k] = ~registers[instruction->left] | registers[instruction->right];
+				break;
+			case IFF_OPERATION:
+				registers[k] = ~(registers[instruction->left] ^ registers[instruction->right]);
+				break;
+			case CUSTOM_OPERATION:
+				registers[k] = _applyOperator(instruction->operator, instruction->arguments, registers);
+				break;
+		}
+	}
+	return registers[compiledFormula->instructionCount - 1];
+}
+
+/**
+ * Sorts the columns by order of declaration of the variables (the undeclared
+ * ones go last, by order of appearance), and renumbers the loads.
+ */
+static void _sortColumns(Builder * builder) {
+	const unsigned int count = builder->variableCount;
+	const unsigned int declared = symbolCount(builder->symbolTable, VARIABLE_SYMBOL);
+	ColumnKey * keys = calloc(count, sizeof(ColumnKey));
+	for (unsigned int column = 0; column < count; ++column) {
+		const Symbol * symbol = lookupSymbol(builder->symbolTable, VARIABLE_SYMBOL, builder->variables[column]);
+		keys[column].column = column;
+		keys[column].key = symbol == NULL ? declared + column : symbol->ordinal;
+	}
+	qsort(keys, count, sizeof(ColumnKey), _compareColumnKeys);
+	CompiledFormula * compiledFormula = builder->compiledFormula;
+	compiledFormula->variables = allocateInArena(compiledFormula->arena, count, sizeof(Identifier *));
+	compiledFormula->variableCount = count;
+	for (unsigned int column = 0; column < count; ++column) {
+		const unsigned int previous = keys[column].column;
+		compiledFormula->variables[column] = builder->variables[previous];
+		builder->instructions[builder->loads[previous]].left = column;
+	}
+	free(keys);
+}
+
+/**
+ * A mask with the lanes of a word that hold valid valuations (all of them,
+ * unless the formula has less than 6 variables).
+ */
+static uint64_t _validLanes(const CompiledFormula * compiledFormula) {
+	return compiledFormula->variableCount < 6 ? (1ull << (1u << compiledFormula->variableCount)) - 1 : ~0ull;
+}
+
+/* PUBLIC FUNCTIONS */
+
+CompiledFormula * compileFormula(const SymbolTable * symbolTable, FormulaDag * formulaDag, const Identifier * formulaName) {
+	const unsigned int root = dagFormula(formulaDag, formulaName);
+	if (root == INVALID_DAG_NODE) {
+		return NULL;
+	}
+	const unsigned int nodeCount = dagNodeCount(formulaDag);
+	if (_registerCapacity < nodeCount) {
+		const unsigned int capacity = 2 * nodeCount;
+		_registers = realloc(_registers, capacity * sizeof(unsigned int));
+		memset(&_registers[_registerCapacity], 0, (capacity - _registerCapacity) * sizeof(unsigned int));
+		_registerCapacity = capacity;
+	}
+	if (_columnCapacity < identifierCount()) {
+		const unsigned int capacity = 2 * identifierCount();
+		_columns = realloc(_columns, capacity * sizeof(unsigned int));
+		memset(&_columns[_columnCapacity], 0xFF, (capacity - _columnCapacity) * sizeof(unsigned int));
+		_columnCapacity = capacity;
+	}
+	CompiledFormula * compiledFormula = calloc(1, sizeof(CompiledFormula));
+	compiledFormula->arena = createArena(COMPILED_FORMULA_BLOCK_SIZE);
+	compiledFormula->name = formulaName;
+	Builder builder = {
+		.symbolTable = symbolTable,
+		.formulaDag = formulaDag,
+		.compiledFormula = compiledFormula,
+		.columns = _columns,
+		.registers = _registers
+	};
+	const unsigned int supportSize = dagAttributes(formulaDag, root)->supportSize;
+	builder.variables = malloc((1 + supportSize) * sizeof(Identifier *));
+	builder.loads = malloc((1 + supportSize) * sizeof(unsigned int));
+	// The operands are compiled before their connectives, so the root is the
+	// last instruction.
+	_compileNodes(&builder, root);
+	_sortColumns(&builder);
+	compiledFormula->instructionCount = builder.instructionCount;
+	compiledFormula->instructions = allocateInArena(compiledFormula->arena, builder.instructionCount, sizeof(Instruction));
+	memcpy(compiledFormula->instructions, builder.instructions, builder.instructionCount * sizeof(Instruction));
+	logDebugging(_logger, "Formula \"%s\" compiled into %u instructions over %u variables.",
+		compiledFormula->name->name, compiledFormula->instructionCount, compiledFormula->variableCount);
+	for (unsigned int k = 0; k < builder.nodeCount; ++k) {
+		_registers[builder.nodes[k]] = 0;
+	}
+	for (unsigned int column = 0; column < compiledFormula->variableCount; ++column) {
+		_columns[compiledFormula->variables[column]->id] = UNVISITED;
+	}
+	free(builder.instructions);
+	free(builder.variables);
+	free(builder.loads);
+	free(builder.nodes);
+	return compiledFormula;
+}
+
+void destroyCompiledFormula(CompiledFormula * compiledFormula) {
+	if (compiledFormula != NULL) {
+		destroyArena(compiledFormula->arena);
+		free(compiledFormula);
+	}
+}
+
+FormulaClass classifyFormula(const CompiledFormula * compiledFormula) {
+	Enumeration enumeration;
+	_beginEnumeration(&enumeration, compiledFormula, threadPoolSize(_threadPool));
+	runChunks(_threadPool, truthTableWordCount(compiledFormula) / enumeration.tileWords, _classifyTile, &enumeration);
+	const boolean satisfiable = enumeration.satisfiable;
+	const boolean falsifiable = enumeration.falsifiable;
+	_endEnumeration(&enumeration);
+	if (satisfiable && falsifiable) {
+		return CONTINGENCY;
+	}
+	return satisfiable ? TAUTOLOGY : CONTRADICTION;
+}
+
+boolean applyOperator(const OperatorTable * operator, const boolean * inputs) {
+	uint64_t input = 0;
+	for (unsigned int k = 0; k < operator->arity; ++k) {
+		input |= (uint64_t) inputs[k] << k;
+	}
+	if (operator->bitmask == NULL) {
+		return coverMatches(operator->trueCover, input);
+	}
+	return (operator->bitmask[input >> 6] >> (input & 63)) & 1;
+}
+
+boolean evaluateFormula(const CompiledFormula * compiledFormula, const boolean * values) {
+	uint64_t * columns = calloc(1 + compiledFormula->variableCount, sizeof(uint64_t));
+	uint64_t * registers = calloc(compiledFormula->instructionCount, sizeof(uint64_t));
+	for (unsigned int column = 0; column < compiledFormula->variableCount; ++column) {
+		columns[column] = values[column] ? ~0ull : 0;
+	}
+	const boolean value = _run(compiledFormula, columns, registers) & 1;
+	free(registers);
+	free(columns);
+	return value;
+}
+
+uint64_t enumerateModels(const CompiledFormula * compiledFormula, ModelConsumer consumer, void * context) {
+	const unsigned int batchTiles = BATCH_TILES_PER_THREAD * threadPoolSize(_threadPool);
+	Enumeration enumeration;
+	_beginEnumeration(&enumeration, compiledFormula, batchTiles);
+	const uint64_t tiles = truthTableWordCount(compiledFormula) / enumeration.tileWords;
+	uint64_t models = 0;
+	for (; enumeration.firstTile < tiles; enumeration.firstTile += batchTiles) {
+		const uint64_t tileCount = tiles - enumeration.firstTile < batchTiles ? tiles - enumeration.firstTile : batchTiles;
+		runChunks(_threadPool, tileCount, _enumerateTile, &enumeration);
+		const uint64_t firstWord = enumeration.firstTile * enumeration.tileWords;
+		for (uint64_t word = 0; word < tileCount * enumeration.tileWords; ++word) {
+			uint64_t result = enumeration.results[word] & enumeration.lanes;
+			if (consumer == NULL) {
+				models += __builtin_popcountll(result);
+				continue;
+			}
+			while (result != 0) {
+				const unsigned int lane = __builtin_ctzll(result);
+				consumer(compiledFormula, 64 * (firstWord + word) + lane, context);
+				result &= result - 1;
+				++models;
+			}
+		}
+	}
+	_endEnumeration(&enumeration);
+	return models;
+}
+
+boolean modelValue(const CompiledFormula * compiledFormula, const uint64_t valuation, const unsigned int column) {
+	return (valuation >> (compiledFormula->variableCount - 1 - column)) & 1;
+}
+
+uint64_t truthTableWordCount(const CompiledFormula * compiledFormula) {
+	return compiledFormula->variableCount <= 6 ? 1 : 1ull << (compiledFormula->variableCount - 6);
+}
+
+const char * formulaClassName(const FormulaClass formulaClass) {
+	switch (formulaClass) {
+		case TAUTOLOGY: return "tautology";
+		case CONTRADICTION: return "contradiction";
+		default: return "contingency";
+	}
+}
@@ -0,0 +1,143 @@
+#ifndef TRUTH_TABLE_ENGINE_HEADER
+#define TRUTH_TABLE_ENGINE_HEADER
+
+#include "../../frontend/semantic-analysis/SemanticAnalyzer.h"
+#include "../../frontend/syntactic-analysis/AbstractSyntaxTree.h"
+#include "../../shared/Arena.h"
+#include "../../shared/Environment.h"
+#include "../../shared/Identifier.h"
+#include "../../shared/Logger.h"
+#include "../../shared/SymbolTable.h"
+#include "../../shared/ThreadPool.h"
+#include "../../shared/Type.h"
+#include "FormulaDag.h"
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/** Initialize module's internal state. */
+void initializeTruthTableEngineModule();
+
+/** Shutdown module's internal state. */
+void shutdownTruthTableEngineModule();
+
+/**
+ * The maximum amount of variables of a formula whose valuations can be
+ * enumerated (the valuations are indexed with 64-bit integers, and every one
+ * of them is visited).
+ */
+#define MAX_TRUTH_TABLE_VARIABLES 40
+
+/**
+ * The semantic class of a formula.
+ */
+typedef enum {
+	TAUTOLOGY,
+	CONTRADICTION,
+	CONTINGENCY
+} FormulaClass;
+
+/**
+ * An instruction of a compiled formula, which writes its own register (i.e.,
+ * the register of an instruction is its index).
+ */
+typedef struct {
+	Opcode opcode;
+
+	// The registers of the operands, or the column of the variable (for the
+	// LOAD_VARIABLE instruction).
+	unsigned int left;
+	unsigned int right;
+
+	// Only for the CUSTOM_OPERATION instruction: the operator, and the
+	// registers of its arguments.
+	const OperatorTable * operator;
+	unsigned int * arguments;
+} Instruction;
+
+/**
+ * A formula compiled into a straight-line program over 64-bit words. Each
+ * word holds 64 valuations, one per bit, so one pass over the program
+ * evaluates 64 valuations. The last instruction computes the formula.
+ */
+typedef struct {
+	// Where the program lives.
+	Arena * arena;
+
+	const Identifier * name;
+	Instruction * instructions;
+	unsigned int instructionCount;
+
+	// The variables of the formula by column, in order of declaration. In the
+	// valuation with index "v", the variable of column "c" is the bit
+	// (variableCount - 1 - c) of "v", so enumerating the valuations by index
+	// produces the rows of the classic truth table.
+	const Identifier ** variables;
+	unsigned int variableCount;
+} CompiledFormula;
+
+/**
+ * A callback that receives each satisfying valuation of a formula, by index.
+ */
+typedef void (*ModelConsumer)(const CompiledFormula * compiledFormula, const uint64_t valuation, void * context);
+
+/**
+ * Compiles a formula from its root in the DAG of the program: every node
+ * reachable from the root becomes one instruction, so the shared subformulas
+ * are computed once. Returns NULL if the formula cannot be lowered into the
+ * DAG.
+ */
+CompiledFormula * compileFormula(const SymbolTable * symbolTable, FormulaDag * formulaDag, const Identifier * formulaName);
+
+/**
+ * Destroy a compiled formula and its resources.
+ */
+void destroyCompiledFormula(CompiledFormula * compiledFormula);
+
+/**
+ * Classifies a formula by enumerating its valuations, a tile of words at a
+ * time, in parallel. Every thread stops as soon as a true and a false
+ * valuation were found.
+ */
+FormulaClass classifyFormula(const CompiledFormula * compiledFormula);
+
+/**
+ * The image of a custom operator for an input (a value per argument), with a
+ * single lookup in its dense table (or, without it, matching its cover of
+ * true).
+ */
+boolean applyOperator(const OperatorTable * operator, const boolean * inputs);
+
+/**
+ * Evaluates a formula under a single valuation, with a value per column.
+ */
+boolean evaluateFormula(const CompiledFormula * compiledFormula, const boolean * values);
+
+/**
+ * Enumerates every satisfying valuation of a formula, in order of index, and
+ * returns the amount of them. The valuations are evaluated in parallel, by
+ * batches of tiles, but the consumer is always called from the calling
+ * thread and in order, no matter how many threads there are. Without a
+ * consumer, the models are only counted.
+ */
+uint64_t enumerateModels(const CompiledFormula * compiledFormula, ModelConsumer consumer, void * context);
+
+/**
+ * The value of a column in the valuation with the specified index.
+ */
+boolean modelValue(const CompiledFormula * compiledFormula, const uint64_t valuation, const unsigned int column);
+
+/**
+ * The amount of words of 64 valuations needed to hold every valuation of a
+ * formula.
+ */
+uint64_t truthTableWordCount(const CompiledFormula * compiledFormula);
+
+/**
+ * The name of a formula class, for diagnostics (e.g., "tautology").
+ */
+const char * formulaClassName(const FormulaClass formulaClass);
+
+#endif
@@ -0,0 +1,181 @@
+#include "TruthTableKernel.h"
+
+/* MODULE INTERNAL STATE */
+
+static Logger * _logger = NULL;
+static const TruthTableKernel * _kernel = NULL;
+
+/**
+ * The columns of the first 6 bits of a valuation index, inside a word of 64
+ * valuations: the bit "b" of the lane "j" is the bit "b" of "j".
+ */
+static const uint64_t _patterns[6] = {
+	0xAAAAAAAAAAAAAAAAull,
+	0xCCCCCCCCCCCCCCCCull,
+	0xF0F0F0F0F0F0F0F0ull,
+	0xFF00FF00FF00FF00ull,
+	0xFFFF0000FFFF0000ull,
+	0xFFFFFFFF00000000ull
+};
+
+/**
+ * Defines a kernel over vectors of "LANES" words, with GCC vector extensions.
+ * The attributes allow the compiler to use a wider instruction set than the
+ * one of the rest of the binary (the kernel only runs if the CPU supports it).
+ */
+#define TRUTH_TABLE_KERNEL(NAME, LANES, ...)                                                                    \
+	__VA_ARGS__ static void NAME(const CompiledFormula * compiledFormula, const uint64_t firstWord,           \
+		const unsigned int wordCount, uint64_t * scratch, uint64_t * results) {                              \
+		typedef uint64_t Vector __attribute__((vector_size(8 * LANES)));                                     \
+		const unsigned int vectors = wordCount / LANES;                                                      \
+		const Vector zero = {0};                                                                             \
+		Vector * registers = (Vector *) scratch;                                                             \
+		for (unsigned int k = 0; k < compiledFormula->instructionCount; ++k) {                               \
+			const Instruction * instruction = &compiledFormula->instructions[k];                             \
+			Vector * target = &registers[k * vectors];                                                       \
+			const Vector * left = &registers[instruction->left * vectors];                                   \
+			const Vector * right = &registers[instruction->right * vectors];                                 \
+			switch (instruction->opcode) {                                                                   \
+				case LOAD_VARIABLE: {                                                                        \
+					const unsigned int bit = compiledFormula->variableCount - 1 - instruction->left;          \
+					for (unsigned int v = 0; v < vectors; ++v) {                                             \
+						if (bit < 6) {                                                                       \
+							target[v] = zero + _patterns[bit];                                               \
+							continue;                                                                        \
+						}                                                                                    \
+						for (unsigned int lane = 0; lane < LANES; ++lane) {                                  \
+							const uint64_t word = firstWord + v * LANES + lane;                              \
+							target[v][lane] = ((word >> (bit - 6)) & 1) ? ~0ull : 0;                          \
+						}                                                                                    \
+					}                                                                                        \
+					break;                                                                                   \
+				}                                                                                            \
+				case NOT_OPERATION:                                                                          \
+					for (unsigned int v = 0; v < vectors; ++v) target[v] = ~left[v];                         \
+					break;                                                                                   \
+				case AND_OPERATION:                                                                          \
+					for (unsigned int v = 0; v < vectors; ++v) target[v] = left[v] & right[v];               \
+					break;                                                                                   \
+				case OR_OPERATION:                                                                           \
+					for (unsigned int v = 0; v < vectors; ++v) target[v] = left[v] | right[v];               \
+					break;                                                                                   \
+				case THEN_OPERATION:                                                                         \
+					for (unsigned int v = 0; v < vectors; ++v) target[v] = ~left[v] | right[v];              \
+					break;                                                                                   \
+				case IFF_OPERATION:                                                                          \
+					for (unsigned int v = 0; v < vectors; ++v) target[v] = ~(left[v] ^ right[v]);            \
+					break;                                                                                   \
+				case CUSTOM_OPERATION: {                                                                     \
+					const OperatorTable * operator = instruction->operator;                                  \
+					const boolean negated = operator->falseCover->count < operator->trueCover->count;        \
+					const CubeCover * cover = negated ? operator->falseCover : operator->trueCover;          \
+					for (unsigned int v = 0; v < vectors; ++v) {                                             \
+						Vector image = zero;                                                                 \
+						for (unsigned int c = 0; c < cover->count; ++c) {                                    \
+							const Cube cube = cover->cubes[c];                                               \
+							Vector lanes = ~zero;                                                            \
+							for (uint64_t care = cube.care; care != 0; care &= care - 1) {                   \
+								const unsigned int a = __builtin_ctzll(care);                                \
+								const Vector argument = registers[instruction->arguments[a] * vectors + v];  \
+								lanes &= ((cube.values >> a) & 1) ? argument : ~argument;                    \
+							}                                                                                \
+							image |= lanes;                                                                  \
+						}                                                                                    \
+						target[v] = negated ? ~image : image;                                                \
+					}                                                                                        \
+					break;                                                                                   \
+				}                                                                                            \
+			}                                                                                                \
+		}                                                                                                    \
+		memcpy(results, &registers[(compiledFormula->instructionCount - 1) * vectors], wordCount * sizeof(uint64_t)); \
+	}
+
+TRUTH_TABLE_KERNEL(_scalarKernel, 1)
+
+#if defined(__x86_64__) || defined(__i386__)
+	TRUTH_TABLE_KERNEL(_sseKernel, 2, __attribute__((target("sse2"))))
+	TRUTH_TABLE_KERNEL(_avx2Kernel, 4, __attribute__((target("avx2"))))
+	TRUTH_TABLE_KERNEL(_avx512Kernel, 8, __attribute__((target("avx512f"))))
+#endif
+
+/**
+ * The available kernels, from the narrowest to the widest one.
+ */
+static const TruthTableKernel _kernels[] = {
+	{"scalar", 1, _scalarKernel},
+#if defined(__x86_64__) || defined(__i386__)
+	{"sse", 2, _sseKernel},
+	{"avx2", 4, _avx2Kernel},
+	{"avx512", 8, _avx512Kernel}
+#endif
+};
+
+static const unsigned int _kernelCount = sizeof(_kernels) / sizeof(TruthTableKernel);
+
+/* PRIVATE FUNCTIONS */
+
+static boolean _isSupported(const TruthTableKernel * kernel);
+
+/**
+ * Returns true if the CPU can run the kernel.
+ */
+static boolean _isSupported(const TruthTableKernel * kernel) {
+#if defined(__x86_64__) || defined(__i386__)
+	switch (kernel->lanes) {
+		case 2: return __builtin_cpu_supports("sse2");
+		case 4: return __builtin_cpu_supports("avx2");
+		case 8: return __builtin_cpu_supports("avx512f");
+	}
+#endif
+	return kernel->lanes == 1;
+}
+
+void initializeTruthTableKernelModule() {
+	_logger = createLogger("TruthTableKernel");
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_cpu_init();
+#endif
+	const char * name = getStringOrDefault("TRUTH_TABLE_KERNEL", "auto");
+	for (unsigned int k = 0; k < _kernelCount; ++k) {
+		const boolean requested = strcmp(name, "auto") == 0 || strcmp(name, _kernels[k].name) == 0;
+		if (requested && _isSupported(&_kernels[k])) {
+			_kernel = &_kernels[k];
+		}
+	}
+	if (_kernel == NULL) {
+		logWarning(_logger, "The truth-table kernel \"%s\" is unknown or unsupported by this CPU (using \"scalar\").", name);
+		_kernel = &_kernels[0];
+	}
+	logDebugging(_logger, "Using the \"%s\" truth-table kernel (%u bits).", _kernel->name, 64 * _kernel->lanes);
+}
+
+void shutdownTruthTableKernelModule() {
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/* PUBLIC FUNCTIONS */
+
+const TruthTableKernel * truthTableKernel(const CompiledFormula * compiledFormula) {
+	return truthTableWordCount(compiledFormula) < _kernel->lanes ? &_kernels[0] : _kernel;
+}
+
+unsigned int truthTableTileWords(const TruthTableKernel * kernel, const CompiledFormula * compiledFormula) {
+	const uint64_t wordCount = truthTableWordCount(compiledFormula);
+	unsigned int tileWords = MAX_TILE_WORDS;
+	while (kernel->lanes < tileWords
+		&& (wordCount < tileWords || L1_DATA_CACHE_BYTES < sizeof(uint64_t) * tileWords * compiledFormula->instructionCount)) {
+		tileWords /= 2;
+	}
+	return tileWords;
+}
+
+uint64_t * allocateKernelScratch(const CompiledFormula * compiledFormula, const unsigned int tileWords) {
+	void * scratch = NULL;
+	if (posix_memalign(&scratch, KERNEL_ALIGNMENT, sizeof(uint64_t) * tileWords * compiledFormula->instructionCount) != 0) {
+		logCritical(_logger, "Cannot allocate the scratch memory of a kernel (%u words).", tileWords * compiledFormula->instructionCount);
+		return NULL;
+	}
+	return scratch;
+}
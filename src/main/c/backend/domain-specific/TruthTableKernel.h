@@ -0,0 +1,77 @@
+#ifndef TRUTH_TABLE_KERNEL_HEADER
+#define TRUTH_TABLE_KERNEL_HEADER
+
+#include "../../shared/Environment.h"
+#include "../../shared/Logger.h"
+#include "../../shared/Type.h"
+#include "TruthTableEngine.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Initialize module's internal state. */
+void initializeTruthTableKernelModule();
+
+/** Shutdown module's internal state. */
+void shutdownTruthTableKernelModule();
+
+/**
+ * The size of the L1 data cache assumed to choose the tiles. The registers of
+ * a whole tile should fit in it.
+ */
+#define L1_DATA_CACHE_BYTES 32768
+
+/**
+ * The maximum amount of words of a tile (i.e., 64K valuations).
+ */
+#define MAX_TILE_WORDS 1024
+
+/**
+ * The alignment of the scratch memory of a kernel (the widest vector).
+ */
+#define KERNEL_ALIGNMENT 64
+
+/**
+ * Runs the program of a formula over a tile of consecutive words, starting at
+ * the word "firstWord", and writes the words of the formula into "results".
+ * The amount of words must be a multiple of the lanes of the kernel, and the
+ * scratch memory must hold "instructionCount * wordCount" words (aligned to
+ * KERNEL_ALIGNMENT bytes). Every instruction is applied to the whole tile
+ * before moving on to the next one.
+ */
+typedef void (*TruthTableKernelFunction)(const CompiledFormula * compiledFormula, const uint64_t firstWord,
+	const unsigned int wordCount, uint64_t * scratch, uint64_t * results);
+
+/**
+ * A kernel, specialized for some vector width.
+ */
+typedef struct {
+	const char * name;
+
+	// The amount of 64-bit words of a vector.
+	unsigned int lanes;
+
+	TruthTableKernelFunction function;
+} TruthTableKernel;
+
+/**
+ * The kernel to use with a formula: the widest one supported by the CPU (or
+ * the one forced with the TRUTH_TABLE_KERNEL environment variable), unless
+ * the formula is too small to fill a vector.
+ */
+const TruthTableKernel * truthTableKernel(const CompiledFormula * compiledFormula);
+
+/**
+ * The amount of words of the tiles of a formula: as many as possible while
+ * its registers fit in the L1 data cache, without exceeding the words of the
+ * formula.
+ */
+unsigned int truthTableTileWords(const TruthTableKernel * kernel, const CompiledFormula * compiledFormula);
+
+/**
+ * Allocates the scratch memory needed to run a formula with a kernel, over
+ * tiles of the specified amount of words. It must be freed with "free".
+ */
+uint64_t * allocateKernelScratch(const CompiledFormula * compiledFormula, const unsigned int tileWords);
+
+#endif
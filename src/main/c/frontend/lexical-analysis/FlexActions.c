@@ -20,13 +20,17 @@ void shutdownFlexActionsModule() {
 /* PRIVATE FUNCTIONS */
 
 static void
-_logLexicalAnalyzerContext(const char *functionName, LexicalAnalyzerContext *lexicalAnalyzerContext);
+_logLexicalAnalyzerContext(const char *functionName, const LexicalAnalyzerContext *lexicalAnalyzerContext);
 
 /**
- * Logs a lexical-analyzer context in DEBUGGING level.
+ * Logs a lexical-analyzer context in DEBUGGING level. The lexeme is escaped
+ * only if the log is going to be visible.
  */
 static void
-_logLexicalAnalyzerContext(const char *functionName, LexicalAnalyzerContext *lexicalAnalyzerContext) {
+_logLexicalAnalyzerContext(const char *functionName, const LexicalAnalyzerContext *lexicalAnalyzerContext) {
+  if (!isLoggable(_logger, DEBUGGING)) {
+    return;
+  }
   char *escapedLexeme = escape(lexicalAnalyzerContext->lexeme);
   logDebugging(_logger, "%s: %s (context = %d, length = %d, line = %d)",
                functionName, escapedLexeme,
@@ -38,56 +42,49 @@ _logLexicalAnalyzerContext(const char *functionName, LexicalAnalyzerContext *lex
 
 /* PUBLIC FUNCTIONS */
 
-void BeginMultilineCommentLexemeAction(LexicalAnalyzerContext *lexicalAnalyzerContext) {
+void BeginMultilineCommentLexemeAction(LexicalAnalyzerContext lexicalAnalyzerContext) {
   if (_logIgnoredLexemes) {
-    _logLexicalAnalyzerContext(__FUNCTION__, lexicalAnalyzerContext);
+    _logLexicalAnalyzerContext(__FUNCTION__, &lexicalAnalyzerContext);
   }
-  destroyLexicalAnalyzerContext(lexicalAnalyzerContext);
 }
 
-void EndMultilineCommentLexemeAction(LexicalAnalyzerContext *lexicalAnalyzerContext) {
+void EndMultilineCommentLexemeAction(LexicalAnalyzerContext lexicalAnalyzerContext) {
   if (_logIgnoredLexemes) {
-    _logLexicalAnalyzerContext(__FUNCTION__, lexicalAnalyzerContext);
+    _logLexicalAnalyzerContext(__FUNCTION__, &lexicalAnalyzerContext);
   }
-  destroyLexicalAnalyzerContext(lexicalAnalyzerContext);
 }
 
-void IgnoredLexemeAction(LexicalAnalyzerContext *lexicalAnalyzerContext) {
+void IgnoredLexemeAction(LexicalAnalyzerContext lexicalAnalyzerContext) {
   if (_logIgnoredLexemes) {
-    _logLexicalAnalyzerContext(__FUNCTION__, lexicalAnalyzerContext);
+    _logLexicalAnalyzerContext(__FUNCTION__, &lexicalAnalyzerContext);
   }
-  destroyLexicalAnalyzerContext(lexicalAnalyzerContext);
 }
 
-Token UnknownLexemeAction(LexicalAnalyzerContext *lexicalAnalyzerContext) {
-  _logLexicalAnalyzerContext(__FUNCTION__, lexicalAnalyzerContext);
-  destroyLexicalAnalyzerContext(lexicalAnalyzerContext);
+Token UnknownLexemeAction(LexicalAnalyzerContext lexicalAnalyzerContext) {
+  _logLexicalAnalyzerContext(__FUNCTION__, &lexicalAnalyzerContext);
   return UNKNOWN;
 }
 
-Token OnlyTokenLexemeAction(LexicalAnalyzerContext *lexicalAnalyzerContext, Token token) {
-  _logLexicalAnalyzerContext(__FUNCTION__, lexicalAnalyzerContext);
-  destroyLexicalAnalyzerContext(lexicalAnalyzerContext);
+Token OnlyTokenLexemeAction(LexicalAnalyzerContext lexicalAnalyzerContext, Token token) {
+  _logLexicalAnalyzerContext(__FUNCTION__, &lexicalAnalyzerContext);
   return token;
 }
 
-Token IdentifierSemanticValueLexemeAction(LexicalAnalyzerContext *lexicalAnalyzerContext, Token token) {
-  _logLexicalAnalyzerContext(__FUNCTION__, lexicalAnalyzerContext);
-  lexicalAnalyzerContext->semanticValue->keywordOrSymbol = lexicalAnalyzerContext->lexeme;
-  destroyLexicalAnalyzerContext(lexicalAnalyzerContext);
+Token IdentifierSemanticValueLexemeAction(LexicalAnalyzerContext lexicalAnalyzerContext, Token token) {
+  _logLexicalAnalyzerContext(__FUNCTION__, &lexicalAnalyzerContext);
+  lexicalAnalyzerContext.semanticValue->identifier =
+      internIdentifier(lexicalAnalyzerContext.lexeme, lexicalAnalyzerContext.length);
   return token;
 }
 
-Token TrueSemanticValueLexemeAction(LexicalAnalyzerContext *lexicalAnalyzerContext) {
-  _logLexicalAnalyzerContext(__FUNCTION__, lexicalAnalyzerContext);
-  lexicalAnalyzerContext->semanticValue->truth_value = true;
-  destroyLexicalAnalyzerContext(lexicalAnalyzerContext);
+Token TrueSemanticValueLexemeAction(LexicalAnalyzerContext lexicalAnalyzerContext) {
+  _logLexicalAnalyzerContext(__FUNCTION__, &lexicalAnalyzerContext);
+  lexicalAnalyzerContext.semanticValue->truth_value = true;
   return TRUE;
 }
 
-Token FalseSemanticValueLexemeAction(LexicalAnalyzerContext *lexicalAnalyzerContext) {
-  _logLexicalAnalyzerContext(__FUNCTION__, lexicalAnalyzerContext);
-  lexicalAnalyzerContext->semanticValue->truth_value = false;
-  destroyLexicalAnalyzerContext(lexicalAnalyzerContext);
+Token FalseSemanticValueLexemeAction(LexicalAnalyzerContext lexicalAnalyzerContext) {
+  _logLexicalAnalyzerContext(__FUNCTION__, &lexicalAnalyzerContext);
+  lexicalAnalyzerContext.semanticValue->truth_value = false;
   return FALSE;
 }
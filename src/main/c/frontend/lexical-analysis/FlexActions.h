@@ -2,6 +2,7 @@
 #define FLEX_ACTIONS_HEADER
 
 #include "../../shared/Environment.h"
+#include "../../shared/Identifier.h"
 #include "../../shared/Logger.h"
 #include "../../shared/String.h"
 #include "../../shared/Type.h"
@@ -18,25 +19,26 @@ void initializeFlexActionsModule();
 void shutdownFlexActionsModule();
 
 /**
- * Flex lexeme processing actions.
+ * Flex lexeme processing actions. Every action receives the context by value,
+ * so the token path never touches the heap: only identifiers are materialized
+ * (interned), because they outlive the lexeme.
  */
 
-void BeginMultilineCommentLexemeAction(
-    LexicalAnalyzerContext *lexicalAnalyzerContext);
+void BeginMultilineCommentLexemeAction(LexicalAnalyzerContext lexicalAnalyzerContext);
 
-void EndMultilineCommentLexemeAction(LexicalAnalyzerContext *lexicalAnalyzerContext);
+void EndMultilineCommentLexemeAction(LexicalAnalyzerContext lexicalAnalyzerContext);
 
-void IgnoredLexemeAction(LexicalAnalyzerContext *lexicalAnalyzerContext);
+void IgnoredLexemeAction(LexicalAnalyzerContext lexicalAnalyzerContext);
 
-Token UnknownLexemeAction(LexicalAnalyzerContext *lexicalAnalyzerContext);
+Token UnknownLexemeAction(LexicalAnalyzerContext lexicalAnalyzerContext);
 
-Token OnlyTokenLexemeAction(LexicalAnalyzerContext *lexicalAnalyzerContext, Token token);
+Token OnlyTokenLexemeAction(LexicalAnalyzerContext lexicalAnalyzerContext, Token token);
 
-Token IdentifierSemanticValueLexemeAction(LexicalAnalyzerContext *lexicalAnalyzerContext, Token token);
+Token IdentifierSemanticValueLexemeAction(LexicalAnalyzerContext lexicalAnalyzerContext, Token token);
 
-Token TrueSemanticValueLexemeAction(LexicalAnalyzerContext *lexicalAnalyzerContext);
+Token TrueSemanticValueLexemeAction(LexicalAnalyzerContext lexicalAnalyzerContext);
 
-Token FalseSemanticValueLexemeAction(LexicalAnalyzerContext *lexicalAnalyzerContext);
+Token FalseSemanticValueLexemeAction(LexicalAnalyzerContext lexicalAnalyzerContext);
 
 
 #endif
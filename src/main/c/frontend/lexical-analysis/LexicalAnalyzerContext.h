@@ -5,26 +5,24 @@
 #include <string.h>
 
 /**
- * The state of a lexical-analyzer context.
+ * The state of a lexical-analyzer context. It's a plain value, meant to live
+ * in the stack of the lexeme action that uses it.
  */
 typedef struct {
 	unsigned int currentContext;
 	unsigned int length;
-	char * lexeme;
+	const char * lexeme;
 	unsigned int line;
 	union SemanticValue * semanticValue;
 } LexicalAnalyzerContext;
 
 /**
  * Creates a new context with the current state of the lexical-analyzer over
- * the lexeme just consumed. The lexeme is a deep-copy of the original,
- * allocated in heap-memory.
+ * the lexeme just consumed. Nothing is allocated: the lexeme is a view over
+ * the buffer of Flex, so it's only valid during the current lexeme action.
+ * Any part of it that must survive the action has to be copied (or interned)
+ * explicitly.
  */
-LexicalAnalyzerContext * createLexicalAnalyzerContext();
-
-/**
- * Destroy a lexical-analyzer context and its resources.
- */
-void destroyLexicalAnalyzerContext(LexicalAnalyzerContext * lexicalAnalyzerContext);
+LexicalAnalyzerContext createLexicalAnalyzerContext();
 
 #endif
@@ -0,0 +1,457 @@
+#include "SemanticAnalyzer.h"
+
+/* MODULE INTERNAL STATE */
+
+/**
+ * The pattern of the argument "k" (for k < 6) inside a word of a compiled
+ * truth table: the bit "v" is the bit "k" of "v".
+ */
+static const uint64_t _argumentPatterns[6] = {
+	0xAAAAAAAAAAAAAAAAull,
+	0xCCCCCCCCCCCCCCCCull,
+	0xF0F0F0F0F0F0F0F0ull,
+	0xFF00FF00FF00FF00ull,
+	0xFFFF0000FFFF0000ull,
+	0xFFFFFFFF00000000ull
+};
+
+static const Identifier * _builtInOperators[5];
+static Logger * _logger = NULL;
+
+// Marks by identifier ID, to find repeated names in linear time: an ID is
+// marked if its entry is equal to the current generation.
+static unsigned int * _marks = NULL;
+static unsigned int _marksCapacity = 0;
+static unsigned int _generation = 0;
+
+void initializeSemanticAnalyzerModule() {
+	_builtInOperators[0] = internIdentifier("&", 1);
+	_builtInOperators[1] = internIdentifier("|", 1);
+	_builtInOperators[2] = internIdentifier("!", 1);
+	_builtInOperators[3] = internIdentifier("=>", 2);
+	_builtInOperators[4] = internIdentifier("<=>", 3);
+	_logger = createLogger("SemanticAnalyzer");
+}
+
+void shutdownSemanticAnalyzerModule() {
+	free(_marks);
+	_marks = NULL;
+	_marksCapacity = 0;
+	if (_logger != NULL) {
+		destroyLogger(_logger);
+	}
+}
+
+/* PRIVATE FUNCTIONS */
+
+static boolean _analyzeStatement(CompilerState * compilerState, Statement * statement);
+static boolean _checkCustomExpression(const SymbolTable * symbolTable, const Identifier * formulaName, const CustomExpression * customExpression);
+static boolean _checkExpression(const SymbolTable * symbolTable, const Identifier * formulaName, const Expression * expression);
+static boolean _checkTruthTable(const DefineOperator * defineOperator);
+static boolean _compileTruthTable(Arena * arena, DefineOperator * defineOperator);
+static boolean _define(SymbolTable * symbolTable, const SymbolKind kind, const Identifier * name, void * definition);
+static boolean _defineVariables(SymbolTable * symbolTable, const VariableList * variableList, DefineVariable * defineVariable);
+static char * _inputName(const unsigned int arity, const uint64_t input);
+static boolean _mark(const Identifier * name);
+static void _reportConflict(const DefineOperator * defineOperator, const CubeCover * rows, const unsigned int row, const uint64_t input);
+static void _reportUnmapped(const DefineOperator * defineOperator, const uint64_t input);
+static void _resetMarks();
+static void _warnIfUndefined(const SymbolTable * symbolTable, const SymbolKind kind, const Identifier * name, const char * where);
+
+/**
+ * Checks the references of a statement, and then defines its symbols.
+ */
+static boolean _analyzeStatement(CompilerState * compilerState, Statement * statement) {
+	SymbolTable * symbolTable = compilerState->symbolTable;
+	boolean succeed = true;
+	switch (statement->type) {
+		case DEFINE_VARIABLE:
+			return _defineVariables(symbolTable, statement->defineVariable->variableList, statement->defineVariable);
+		case DEFINE_FORMULA: {
+			DefineFormula * defineFormula = statement->defineFormula;
+			// Each unresolved reference is reported once per formula.
+			_resetMarks();
+			succeed = _checkExpression(symbolTable, defineFormula->name, defineFormula->expression);
+			return _define(symbolTable, FORMULA_SYMBOL, defineFormula->name, defineFormula) && succeed;
+		}
+		case DEFINE_VALUATION: {
+			DefineValuation * defineValuation = statement->defineValuation;
+			_resetMarks();
+			const ValuationList * valuationList = defineValuation->valuationList;
+			for (unsigned int k = 0; k < valuationList->count; ++k) {
+				const Valuation * valuation = valuationList->valuations[k];
+				_warnIfUndefined(symbolTable, VARIABLE_SYMBOL, valuation->variable, defineValuation->name->name);
+				if (!_mark(valuation->variable)) {
+					logError(_logger, "The valuation \"%s\" assigns the variable \"%s\" more than once.",
+						defineValuation->name->name, valuation->variable->name);
+					succeed = false;
+				}
+			}
+			return _define(symbolTable, VALUATION_SYMBOL, defineValuation->name, defineValuation) && succeed;
+		}
+		case DEFINE_OPERATOR: {
+			DefineOperator * defineOperator = statement->defineOperator;
+			succeed = _checkTruthTable(defineOperator) && _compileTruthTable(compilerState->arena, defineOperator);
+			return _define(symbolTable, OPERATOR_SYMBOL, defineOperator->customOperator->name, defineOperator) && succeed;
+		}
+		case DEFINE_OPSET: {
+			DefineOpset * defineOpset = statement->defineOpset;
+			const OpsetList * opsetList = defineOpset->opsetList;
+			for (unsigned int k = 0; k < opsetList->count; ++k) {
+				if (!isBuiltInOperator(opsetList->operators[k])) {
+					_warnIfUndefined(symbolTable, OPERATOR_SYMBOL, opsetList->operators[k], defineOpset->name->name);
+				}
+			}
+			return _define(symbolTable, OPSET_SYMBOL, defineOpset->name, defineOpset);
+		}
+		case EVALUATE_STATEMENT:
+			_warnIfUndefined(symbolTable, FORMULA_SYMBOL, statement->evaluateStatement->formulaName, "evaluate");
+			_warnIfUndefined(symbolTable, VALUATION_SYMBOL, statement->evaluateStatement->valuationName, "evaluate");
+			return true;
+		case ADEQUATE_STATEMENT:
+			_warnIfUndefined(symbolTable, OPSET_SYMBOL, statement->adequateStatement->opsetName, "adequate");
+			return true;
+		case FORMULA_ANALYSIS_STATEMENT:
+			_warnIfUndefined(symbolTable, FORMULA_SYMBOL, statement->formulaAnalysisStatement->formulaName,
+				formulaAnalysisName(statement->formulaAnalysisStatement->type));
+			return true;
+		case CONGRUENCE_STATEMENT:
+			_warnIfUndefined(symbolTable, FORMULA_SYMBOL, statement->congruenceStatement->leftFormulaName, "congruent");
+			_warnIfUndefined(symbolTable, FORMULA_SYMBOL, statement->congruenceStatement->rightFormulaName, "congruent");
+			return true;
+		default:
+			logError(_logger, "The specified statement type is unknown: %d", statement->type);
+			return false;
+	}
+}
+
+/**
+ * Checks a reference to a formula, or an application of a custom operator,
+ * which must match the arity of its definition.
+ */
+static boolean _checkCustomExpression(const SymbolTable * symbolTable, const Identifier * formulaName, const CustomExpression * customExpression) {
+	if (customExpression->type == PREDEFINED_FORMULA) {
+		if (_mark(customExpression->predefinedFormula)) {
+			_warnIfUndefined(symbolTable, FORMULA_SYMBOL, customExpression->predefinedFormula, formulaName->name);
+		}
+		return true;
+	}
+	const CustomOperator * application = customExpression->customOperator;
+	const VariableList * arguments = application->variableList;
+	for (unsigned int k = 0; k < arguments->count; ++k) {
+		if (_mark(arguments->variables[k])) {
+			_warnIfUndefined(symbolTable, VARIABLE_SYMBOL, arguments->variables[k], formulaName->name);
+		}
+	}
+	const Symbol * symbol = lookupSymbol(symbolTable, OPERATOR_SYMBOL, application->name);
+	if (symbol == NULL) {
+		if (_mark(application->name)) {
+			_warnIfUndefined(symbolTable, OPERATOR_SYMBOL, application->name, formulaName->name);
+		}
+		return true;
+	}
+	const DefineOperator * defineOperator = symbol->definition;
+	const unsigned int arity = defineOperator->customOperator->variableList->count;
+	if (arity != arguments->count) {
+		logError(_logger, "The operator \"%s\" has arity %u, but it's applied to %u argument(s) in \"%s\".",
+			application->name->name, arity, arguments->count, formulaName->name);
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Checks every reference inside the expression of a formula, from left to
+ * right. The subexpressions wait in an explicit stack (in heap-memory), so
+ * the nesting of the formula doesn't grow the native stack.
+ */
+static boolean _checkExpression(const SymbolTable * symbolTable, const Identifier * formulaName, const Expression * expression) {
+	boolean succeed = true;
+	unsigned int capacity = 64;
+	unsigned int size = 0;
+	const Expression ** stack = malloc(capacity * sizeof(Expression *));
+	stack[size++] = expression;
+	while (0 < size) {
+		const Expression * current = stack[--size];
+		if (capacity < size + 2) {
+			capacity *= 2;
+			stack = realloc(stack, capacity * sizeof(Expression *));
+		}
+		switch (current->type) {
+			case NOT_EXPRESSION:
+				stack[size++] = current->notExpression->expression;
+				break;
+			case BINARY_EXPRESSION:
+				stack[size++] = current->binaryExpression->rightExpression;
+				stack[size++] = current->binaryExpression->leftExpression;
+				break;
+			case CUSTOM_EXPRESSION:
+				succeed = _checkCustomExpression(symbolTable, formulaName, current->customExpression) && succeed;
+				break;
+			case VARIABLE_EXPRESSION:
+				if (_mark(current->variable)) {
+					_warnIfUndefined(symbolTable, VARIABLE_SYMBOL, current->variable, formulaName->name);
+				}
+				break;
+			default:
+				logError(_logger, "The specified expression type is unknown: %d", current->type);
+				succeed = false;
+				break;
+		}
+	}
+	free(stack);
+	return succeed;
+}
+
+/**
+ * Checks that the arity of an operator can be compiled, and that every row of
+ * its truth table has as many truth values as parameters has the operator.
+ */
+static boolean _checkTruthTable(const DefineOperator * defineOperator) {
+	const unsigned int arity = defineOperator->customOperator->variableList->count;
+	if (MAX_OPERATOR_ARITY < arity) {
+		logError(_logger, "The operator \"%s\" has arity %u, but the maximum is %u.",
+			defineOperator->customOperator->name->name, arity, MAX_OPERATOR_ARITY);
+		return false;
+	}
+	boolean succeed = true;
+	const TruthTable * table = defineOperator->truthTable;
+	for (unsigned int k = 0; k < table->count; ++k) {
+		if (table->entries[k]->type != TRUTH_VALUE_LIST) {
+			continue;
+		}
+		const unsigned int length = table->entries[k]->truthValueList->count;
+		if (length != arity) {
+			logError(_logger, "The operator \"%s\" has arity %u, but a row of its truth table has %u value(s).",
+				defineOperator->customOperator->name->name, arity, length);
+			succeed = false;
+		}
+	}
+	return succeed;
+}
+
+/**
+ * Compiles the truth table of an operator, checking that the rows which match
+ * an input agree on its image, and that (without an "otherwise" entry) some
+ * row matches every input. Up to MAX_DENSE_ARITY, the rows are painted into a
+ * dense bitmask, in source order: each row is a cube, with a mask per word
+ * from the patterns of its first 6 values, and empty in the words that the
+ * rest of its values exclude, so the same pass finds the conflicts and the
+ * unmapped inputs. Above it, the table is left as cubes (the backend lowers
+ * them into covers), and the cubes are checked pairwise for conflicts, while
+ * the unmapped inputs are found splitting the inputs out of every row.
+ */
+static boolean _compileTruthTable(Arena * arena, DefineOperator * defineOperator) {
+	const unsigned int arity = defineOperator->customOperator->variableList->count;
+	const TruthTable * table = defineOperator->truthTable;
+	const TruthTableEntry * otherwise = NULL;
+	CubeCover * rows = createCubeCover();
+	boolean * images = calloc(1 + table->count, sizeof(boolean));
+	unsigned int rowCount = 0;
+	for (unsigned int k = 0; k < table->count; ++k) {
+		if (table->entries[k]->type == OTHERWISE_ENTRY) {
+			otherwise = table->entries[k];
+		}
+		else {
+			addCube(rows, truthTableRowCube(table->entries[k]));
+			images[rowCount++] = table->entries[k]->mapValue->value;
+		}
+	}
+	boolean succeed = true;
+	if (arity <= MAX_DENSE_ARITY) {
+		const uint64_t wordCount = arity <= 6 ? 1 : 1ull << (arity - 6);
+		const uint64_t mask = arity < 6 ? (1ull << (1u << arity)) - 1 : ~0ull;
+		uint64_t * bitmask = allocateInArena(arena, wordCount, sizeof(uint64_t));
+		uint64_t * covered = calloc(wordCount, sizeof(uint64_t));
+		for (unsigned int row = 0; row < rowCount && succeed; ++row) {
+			const Cube cube = rows->cubes[row];
+			uint64_t wordMask = mask;
+			for (unsigned int k = 0; k < arity && k < 6; ++k) {
+				if ((cube.care >> k) & 1) {
+					wordMask &= ((cube.values >> k) & 1) ? _argumentPatterns[k] : ~_argumentPatterns[k];
+				}
+			}
+			const uint64_t image = images[row] ? ~0ull : 0;
+			for (uint64_t word = 0; word < wordCount && succeed; ++word) {
+				if (((word ^ (cube.values >> 6)) & (cube.care >> 6)) != 0) {
+					continue;
+				}
+				const uint64_t conflicts = wordMask & covered[word] & (bitmask[word] ^ image);
+				if (conflicts != 0) {
+					_reportConflict(defineOperator, rows, row, 64 * word + __builtin_ctzll(conflicts));
+					succeed = false;
+				}
+				bitmask[word] |= wordMask & image;
+				covered[word] |= wordMask;
+			}
+		}
+		for (uint64_t word = 0; word < wordCount && succeed; ++word) {
+			const uint64_t uncovered = ~covered[word] & mask;
+			if (otherwise != NULL) {
+				bitmask[word] |= otherwise->otherwiseValue->value ? uncovered : 0;
+			}
+			else if (uncovered != 0) {
+				_reportUnmapped(defineOperator, 64 * word + __builtin_ctzll(uncovered));
+				succeed = false;
+			}
+		}
+		free(covered);
+		defineOperator->bitmask = bitmask;
+	}
+	else {
+		for (unsigned int row = 0; row < rowCount && succeed; ++row) {
+			for (unsigned int previous = 0; previous < row && succeed; ++previous) {
+				if (images[previous] != images[row] && cubesIntersect(rows->cubes[previous], rows->cubes[row])) {
+					_reportConflict(defineOperator, rows, row, rows->cubes[previous].values | rows->cubes[row].values);
+					succeed = false;
+				}
+			}
+		}
+		const Cube everyInput = {.care = 0, .values = 0};
+		uint64_t input = 0;
+		if (succeed && otherwise == NULL && findUncoveredInput(rows, everyInput, &input)) {
+			_reportUnmapped(defineOperator, input);
+			succeed = false;
+		}
+	}
+	free(images);
+	destroyCubeCover(rows);
+	return succeed;
+}
+
+/**
+ * Defines a new symbol, logging an error if it was already defined.
+ */
+static boolean _define(SymbolTable * symbolTable, const SymbolKind kind, const Identifier * name, void * definition) {
+	if (insertSymbol(symbolTable, kind, name, definition) == NULL) {
+		logError(_logger, "The %s \"%s\" is already defined.", symbolKindName(kind), name->name);
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Defines the variables of a list in source order, so their ordinals follow
+ * the order of declaration.
+ */
+static boolean _defineVariables(SymbolTable * symbolTable, const VariableList * variableList, DefineVariable * defineVariable) {
+	boolean succeed = true;
+	for (unsigned int k = 0; k < variableList->count; ++k) {
+		succeed = _define(symbolTable, VARIABLE_SYMBOL, variableList->variables[k], defineVariable) && succeed;
+	}
+	return succeed;
+}
+
+/**
+ * The name of an input of an operator, for diagnostics (e.g., "(true, false)").
+ * The bit "k" of the input is the argument "k" of the lists of the AST.
+ */
+static char * _inputName(const unsigned int arity, const uint64_t input) {
+	char * inputName = calloc(2 + 7 * arity, sizeof(char));
+	strcat(inputName, "(");
+	for (unsigned int k = 0; k < arity; ++k) {
+		strcat(inputName, k == 0 ? "" : ", ");
+		strcat(inputName, ((input >> k) & 1) ? "true" : "false");
+	}
+	strcat(inputName, ")");
+	return inputName;
+}
+
+/**
+ * Marks a name in the current generation. Returns false if it was already
+ * marked.
+ */
+static boolean _mark(const Identifier * name) {
+	if (_marks[name->id] == _generation) {
+		return false;
+	}
+	_marks[name->id] = _generation;
+	return true;
+}
+
+/**
+ * Logs the conflict of a row with the first previous row that matches the
+ * same input, but maps it to a different value.
+ */
+static void _reportConflict(const DefineOperator * defineOperator, const CubeCover * rows, const unsigned int row, const uint64_t input) {
+	unsigned int previous = 0;
+	while (((input ^ rows->cubes[previous].values) & rows->cubes[previous].care) != 0) {
+		++previous;
+	}
+	char * inputName = _inputName(defineOperator->customOperator->variableList->count, input);
+	logError(_logger, "The rows %u and %u of the truth table of the operator \"%s\" map the input %s to different values.",
+		1 + previous, 1 + row, defineOperator->customOperator->name->name, inputName);
+	free(inputName);
+}
+
+/**
+ * Logs an input that no row of a truth table matches.
+ */
+static void _reportUnmapped(const DefineOperator * defineOperator, const uint64_t input) {
+	char * inputName = _inputName(defineOperator->customOperator->variableList->count, input);
+	logError(_logger, "The truth table of the operator \"%s\" does not map the input %s (and it has no \"otherwise\" entry).",
+		defineOperator->customOperator->name->name, inputName);
+	free(inputName);
+}
+
+/**
+ * Starts a new generation of marks, where every identifier is unmarked.
+ */
+static void _resetMarks() {
+	const unsigned int count = identifierCount();
+	if (_marksCapacity < count) {
+		free(_marks);
+		_marksCapacity = 2 * count;
+		_marks = calloc(_marksCapacity, sizeof(unsigned int));
+		_generation = 0;
+	}
+	++_generation;
+}
+
+/**
+ * Logs a warning if the name is not (yet) defined in the namespace of a kind.
+ */
+static void _warnIfUndefined(const SymbolTable * symbolTable, const SymbolKind kind, const Identifier * name, const char * where) {
+	if (lookupSymbol(symbolTable, kind, name) == NULL) {
+		logWarning(_logger, "Undefined %s \"%s\" (referenced in \"%s\").", symbolKindName(kind), name->name, where);
+	}
+}
+
+/* PUBLIC FUNCTIONS */
+
+SemanticAnalysisStatus analyzeSemantics(CompilerState * compilerState) {
+	logDebugging(_logger, "Analyzing semantics...");
+	const Program * program = compilerState->abstractSyntaxtTree;
+	boolean succeed = true;
+	for (unsigned int k = 0; k < program->count; ++k) {
+		succeed = _analyzeStatement(compilerState, program->statements[k]) && succeed;
+	}
+	logDebugging(_logger, "Semantic analysis is done (%u statements).", program->count);
+	return succeed ? SEMANTIC_ACCEPT : SEMANTIC_REJECT;
+}
+
+SemanticAnalysisStatus analyzeStatement(CompilerState * compilerState, Statement * statement) {
+	return _analyzeStatement(compilerState, statement) ? SEMANTIC_ACCEPT : SEMANTIC_REJECT;
+}
+
+boolean isBuiltInOperator(const Identifier * name) {
+	for (unsigned int k = 0; k < sizeof(_builtInOperators) / sizeof(_builtInOperators[0]); ++k) {
+		if (_builtInOperators[k] == name) {
+			return true;
+		}
+	}
+	return false;
+}
+
+Cube truthTableRowCube(const TruthTableEntry * entry) {
+	Cube cube = {.care = 0, .values = 0};
+	const TruthValueList * list = entry->truthValueList;
+	for (unsigned int k = 0; k < list->count; ++k) {
+		const TruthValueOrWildcard * value = list->truthValues[k];
+		if (value->type != WILDCARD_VALUE) {
+			cube.care |= 1ull << k;
+			cube.values |= (uint64_t) value->truthValue->value << k;
+		}
+	}
+	return cube;
+}
@@ -0,0 +1,64 @@
+#ifndef SEMANTIC_ANALYZER_HEADER
+#define SEMANTIC_ANALYZER_HEADER
+
+#include "../../shared/Arena.h"
+#include "../../shared/CompilerState.h"
+#include "../../shared/CubeCover.h"
+#include "../../shared/Identifier.h"
+#include "../../shared/Logger.h"
+#include "../../shared/SymbolTable.h"
+#include "../../shared/Type.h"
+#include "../syntactic-analysis/AbstractSyntaxTree.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Initialize module's internal state. */
+void initializeSemanticAnalyzerModule();
+
+/** Shutdown module's internal state. */
+void shutdownSemanticAnalyzerModule();
+
+/**
+ * The maximum arity of a custom operator, and the maximum arity of the ones
+ * whose truth table is compiled into a dense bitmask of 2^arity bits (the
+ * rest of them are kept as cubes).
+ */
+#define MAX_OPERATOR_ARITY 24
+#define MAX_DENSE_ARITY 15
+
+typedef enum {
+	SEMANTIC_ACCEPT,
+	SEMANTIC_REJECT
+} SemanticAnalysisStatus;
+
+/**
+ * Executes the semantic-analysis phase of the compiler over the AST of the
+ * compiler state. It fills the symbol table once, visiting the statements in
+ * order, so every reference must be defined before it's used. Redefinitions
+ * and malformed definitions (e.g., a truth table that maps an input to both
+ * values, or that does not map some input) reject the program; unresolved
+ * references are only reported, and the statements that depend on them are not analyzed.
+ */
+SemanticAnalysisStatus analyzeSemantics(CompilerState * compilerState);
+
+/**
+ * Analyzes a single statement, as "analyzeSemantics" does for each statement
+ * of the program (in streaming mode, each one is analyzed as soon as it's
+ * reduced).
+ */
+SemanticAnalysisStatus analyzeStatement(CompilerState * compilerState, Statement * statement);
+
+/**
+ * Returns true if the name is one of the built-in connectives ("&", "|", "!",
+ * "=>" or "<=>").
+ */
+boolean isBuiltInOperator(const Identifier * name);
+
+/**
+ * The cube of the inputs that a row of a truth table matches: the bit "k" is
+ * the value "k" of its truth-value list.
+ */
+Cube truthTableRowCube(const TruthTableEntry * entry);
+
+#endif
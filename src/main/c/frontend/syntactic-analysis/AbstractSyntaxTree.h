@@ -1,8 +1,10 @@
 #ifndef ABSTRACT_SYNTAX_TREE_HEADER
 #define ABSTRACT_SYNTAX_TREE_HEADER
 
+#include "../../shared/Identifier.h"
 #include "../../shared/Logger.h"
 #include "../../shared/Type.h"
+#include <stdint.h>
 #include <stdlib.h>
 
 /** Initialize module's internal state. */
@@ -21,6 +23,7 @@ typedef enum BinaryOperatorType BinaryOperatorType;
 typedef enum CustomExpressionType CustomExpressionType;
 typedef enum TruthTableEntryType TruthTableEntryType;
 typedef enum TruthValueOrWildcardType TruthValueOrWildcardType;
+typedef enum FormulaAnalysisType FormulaAnalysisType;
 
 typedef struct Program Program;
 typedef struct Statement Statement;
@@ -32,10 +35,10 @@ typedef struct CustomExpression CustomExpression;
 
 typedef struct DefineVariable DefineVariable;
 typedef struct VariableList VariableList;
-typedef const char * Variable;
+typedef const Identifier * Variable;
 
 typedef struct DefineFormula DefineFormula;
-typedef const char * PredefinedFormula;
+typedef const Identifier * PredefinedFormula;
 
 typedef struct DefineValuation DefineValuation;
 typedef struct ValuationList ValuationList;
@@ -47,10 +50,12 @@ typedef struct OpsetList OpsetList;
 typedef struct DefineOperator DefineOperator;
 typedef struct BinaryOperator BinaryOperator;
 typedef struct CustomOperator CustomOperator;
-typedef const char * Operator;
+typedef const Identifier * Operator;
 
 typedef struct AdequateStatement AdequateStatement;
 typedef struct EvaluateStatement EvaluateStatement;
+typedef struct CongruenceStatement CongruenceStatement;
+typedef struct FormulaAnalysisStatement FormulaAnalysisStatement;
 
 typedef struct TruthTable TruthTable;
 typedef struct TruthTableEntry TruthTableEntry;
@@ -91,9 +96,17 @@ enum TruthValueOrWildcardType {
 	WILDCARD_VALUE
 };
 
+enum FormulaAnalysisType {
+	CLASSIFY_ANALYSIS,
+	MODELS_ANALYSIS,
+	CNF_ANALYSIS,
+	COUNT_ANALYSIS,
+	COMPLEXITY_ANALYSIS
+};
+
 // FORMULA
 struct DefineFormula {
-	const char * name;
+	const Identifier * name;
 	Expression * expression;
 };
 
@@ -132,10 +145,13 @@ struct CustomExpression {
 struct DefineOperator {
 	CustomOperator * customOperator;
 	TruthTable * truthTable;
+	// The truth table compiled by the semantic analysis: the bit "v" is the
+	// image of the input where the argument "k" is the bit "k" of "v".
+	const uint64_t * bitmask;
 };
 
 struct CustomOperator {
-	const char * name;
+	const Identifier * name;
 	VariableList * variableList;
 };
 
@@ -145,19 +161,21 @@ struct DefineVariable {
 };
 
 struct VariableList {
-	Variable variable;
-	VariableList * next;
+	Variable * variables;
+	unsigned int count;
+	unsigned int capacity;
 };
 
 // VALUATION
 struct DefineValuation {
-	const char * name;
+	const Identifier * name;
 	ValuationList * valuationList;
 };
 
 struct ValuationList {
-	Valuation * valuation;
-	ValuationList * next;
+	Valuation ** valuations;
+	unsigned int count;
+	unsigned int capacity;
 };
 
 struct Valuation {
@@ -167,32 +185,46 @@ struct Valuation {
 
 //OPSET
 struct DefineOpset {
-	const char * name;
+	const Identifier * name;
 	OpsetList * opsetList;
 };
 
 struct OpsetList {
-	Operator operator;
-	OpsetList * next;
+	Operator * operators;
+	unsigned int count;
+	unsigned int capacity;
 };
 
 
 // ADEQUACY
 struct AdequateStatement {
-	const char * opsetName;
+	const Identifier * opsetName;
 };
 
 
 // EVALUATION
 struct EvaluateStatement {
-	const char * formulaName;
-	const char * valuationName;
+	const Identifier * formulaName;
+	const Identifier * valuationName;
+};
+
+// CONGRUENCE
+struct CongruenceStatement {
+	const Identifier * leftFormulaName;
+	const Identifier * rightFormulaName;
+};
+
+// FORMULA ANALYSIS
+struct FormulaAnalysisStatement {
+	const Identifier * formulaName;
+	FormulaAnalysisType type;
 };
 
 //TRUTH TABLE
 struct TruthTable {
-	TruthTableEntry * entry;
-	TruthTable * next;
+	TruthTableEntry ** entries;
+	unsigned int count;
+	unsigned int capacity;
 };
 
 struct TruthTableEntry {
@@ -207,8 +239,9 @@ struct TruthTableEntry {
 };
 
 struct TruthValueList {
-	TruthValueOrWildcard * truthValueOrWildcard;
-	TruthValueList * next;
+	TruthValueOrWildcard ** truthValues;
+	unsigned int count;
+	unsigned int capacity;
 };
 
 struct TruthValueOrWildcard {
@@ -231,7 +264,9 @@ enum StatementType {
 	DEFINE_OPERATOR,
 	DEFINE_OPSET,
 	EVALUATE_STATEMENT,
-	ADEQUATE_STATEMENT
+	ADEQUATE_STATEMENT,
+	FORMULA_ANALYSIS_STATEMENT,
+	CONGRUENCE_STATEMENT
 };
 
 struct Statement {
@@ -243,48 +278,34 @@ struct Statement {
 		DefineOpset * defineOpset;
 		EvaluateStatement * evaluateStatement;
 		AdequateStatement * adequateStatement;
+		FormulaAnalysisStatement * formulaAnalysisStatement;
+		CongruenceStatement * congruenceStatement;
 	};
 	StatementType type;
 };
 
 struct Program {
-	Statement * statement;
-	Program * next;	
+	Statement ** statements;
+	unsigned int count;
+	unsigned int capacity;
 };
 
 /**
- * Node recursive destructors.
+ * The keyword of a formula analysis (e.g., "classify"), for diagnostics.
  */
-void releaseProgram(Program * program);
-void releaseStatement(Statement * statement);
-
-void releaseExpression(Expression * expression);
-void releaseNotExpression(NotExpression * notExpression);
-void releaseBinaryExpression(BinaryExpression * binaryExpression);
-void releaseCustomExpression(CustomExpression * customExpression);
+const char * formulaAnalysisName(const FormulaAnalysisType type);
 
-void releaseDefineVariable(DefineVariable * defineVariable);
-void releaseVariableList(VariableList * variableList);
-
-void releaseDefineFormula(DefineFormula * defineFormula);
-
-void releaseDefineValuation(DefineValuation * defineValuation);
-void releaseValuationList(ValuationList * valuationList);
-void releaseValuation(Valuation * valuation);
-
-void releaseDefineOpset(DefineOpset * defineOpset);
-void releaseOpsetList(OpsetList * opsetList);
-
-void releaseDefineOperator(DefineOperator * defineOperator);
-void releaseCustomOperator(CustomOperator * customOperator);
-
-void releaseAdequateStatement(AdequateStatement * adequateStatement);
-void releaseEvaluateStatement(EvaluateStatement * evaluateStatement);
-
-void releaseTruthTable(TruthTable * truthTable);
-void releaseTruthTableEntry(TruthTableEntry * truthTableEntry);
-void releaseTruthValueList(TruthValueList * truthValueList);
-void releaseTruthValueOrWildcard(TruthValueOrWildcard * truthValueOrWildcard);
-void releaseTruthValue(TruthValue * truthValue);
+/**
+ * Every list of the AST (and the program itself) is a growable array in
+ * source order, whose elements live in the arena too, so its length is O(1),
+ * and its elements are indexed.
+ *
+ * There are no node destructors: every node is allocated inside the arena of
+ * the compiler state, and the entire tree is released with that arena. The
+ * expressions live in an arena of their own, released as soon as the formulas
+ * are lowered into the DAG of the backend, and so do the statements (and the
+ * nodes of the statements that define nothing), which are released after each
+ * statement in streaming mode.
+ */
 
 #endif
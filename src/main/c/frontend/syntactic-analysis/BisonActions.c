@@ -18,8 +18,56 @@ extern unsigned int flexCurrentContext(void);
 
 /* PRIVATE FUNCTIONS */
 
+static void *_allocate(const size_t size);
+static void *_allocateExpression(const size_t size);
+static void *_allocateStatement(const size_t size);
+static void *_grow(Arena *arena, void *elements, const unsigned int count,
+                   unsigned int *capacity, const size_t size);
 static void _logSyntacticAnalyzerAction(const char *functionName);
 
+/**
+ * Allocates a zero-initialized AST node inside the arena of the current
+ * compilation. Nodes are never released one by one: the whole tree goes away
+ * when the arena is destroyed.
+ */
+static void *_allocate(const size_t size) {
+  return allocateInArena(currentCompilerState()->arena, 1, size);
+}
+
+/**
+ * Allocates a zero-initialized expression node inside the arena of the
+ * expressions, which is released before the rest of the tree.
+ */
+static void *_allocateExpression(const size_t size) {
+  return allocateInArena(currentCompilerState()->expressionArena, 1, size);
+}
+
+/**
+ * Allocates a zero-initialized statement node (or a node of a statement that
+ * defines nothing) inside the arena of the statements, which lives only as
+ * long as its statement in streaming mode.
+ */
+static void *_allocateStatement(const size_t size) {
+  return allocateInArena(currentCompilerState()->statementArena, 1, size);
+}
+
+/**
+ * Makes room for one more element at the end of a growable array of the AST,
+ * doubling its capacity when it's full, inside the arena that owns the array
+ * (the one of its node). Returns the (maybe moved) array.
+ */
+static void *_grow(Arena *arena, void *elements, const unsigned int count,
+                   unsigned int *capacity, const size_t size) {
+  if (count < *capacity) {
+    return elements;
+  }
+  const unsigned int newCapacity = *capacity == 0 ? 4 : 2 * *capacity;
+  void *grownElements =
+      reallocateInArena(arena, elements, *capacity, newCapacity, size);
+  *capacity = newCapacity;
+  return grownElements;
+}
+
 /**
  * Logs a syntactic-analyzer action in DEBUGGING level.
  */
@@ -31,16 +79,20 @@ static void _logSyntacticAnalyzerAction(const char *functionName) {
 
 TruthTable *TruthTableAction(TruthTable *table, TruthTableEntry *entry) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  TruthTable *truthTable = calloc(1, sizeof(TruthTable));
-  truthTable->entry = entry;
-  truthTable->next = table;
+  TruthTable *truthTable =
+      table == NULL ? _allocate(sizeof(TruthTable)) : table;
+  truthTable->entries =
+      _grow(currentCompilerState()->arena, truthTable->entries,
+            truthTable->count, &truthTable->capacity,
+            sizeof(TruthTableEntry *));
+  truthTable->entries[truthTable->count++] = entry;
   return truthTable;
 }
 
 TruthTableEntry *TruthTableMapperEntryAction(TruthValueList *truthValueList,
                                              TruthValue *mapValue) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  TruthTableEntry *truthTableEntry = calloc(1, sizeof(TruthTableEntry));
+  TruthTableEntry *truthTableEntry = _allocate(sizeof(TruthTableEntry));
   truthTableEntry->truthValueList = truthValueList;
   truthTableEntry->mapValue = mapValue;
   truthTableEntry->type = TRUTH_VALUE_LIST;
@@ -49,7 +101,7 @@ TruthTableEntry *TruthTableMapperEntryAction(TruthValueList *truthValueList,
 
 TruthTableEntry *TruthTableOtherwiseEntryAction(TruthValue *otherwiseValue) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  TruthTableEntry *truthTableEntry = calloc(1, sizeof(TruthTableEntry));
+  TruthTableEntry *truthTableEntry = _allocate(sizeof(TruthTableEntry));
   truthTableEntry->otherwiseValue = otherwiseValue;
   truthTableEntry->type = OTHERWISE_ENTRY;
   return truthTableEntry;
@@ -59,16 +111,20 @@ TruthValueList *
 TruthValueListAction(TruthValueList *truthValueList,
                      TruthValueOrWildcard *truthValueOrWildcard) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  TruthValueList *newTruthValueList = calloc(1, sizeof(TruthValueList));
-  newTruthValueList->truthValueOrWildcard = truthValueOrWildcard;
-  newTruthValueList->next = truthValueList;
-  return newTruthValueList;
+  TruthValueList *list = truthValueList == NULL
+                             ? _allocate(sizeof(TruthValueList))
+                             : truthValueList;
+  list->truthValues =
+      _grow(currentCompilerState()->arena, list->truthValues, list->count,
+            &list->capacity, sizeof(TruthValueOrWildcard *));
+  list->truthValues[list->count++] = truthValueOrWildcard;
+  return list;
 }
 
 TruthValueOrWildcard *TruthValueTypeAction(TruthValue *truthValue) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
   TruthValueOrWildcard *truthValueOrWildcard =
-      calloc(1, sizeof(TruthValueOrWildcard));
+      _allocate(sizeof(TruthValueOrWildcard));
   truthValueOrWildcard->truthValue = truthValue;
   truthValueOrWildcard->type = TRUTH_VALUE;
   return truthValueOrWildcard;
@@ -77,14 +133,14 @@ TruthValueOrWildcard *TruthValueTypeAction(TruthValue *truthValue) {
 TruthValueOrWildcard *WildcardTypeAction() {
   _logSyntacticAnalyzerAction(__FUNCTION__);
   TruthValueOrWildcard *truthValueOrWildcard =
-      calloc(1, sizeof(TruthValueOrWildcard));
+      _allocate(sizeof(TruthValueOrWildcard));
   truthValueOrWildcard->type = WILDCARD_VALUE;
   return truthValueOrWildcard;
 }
 
 TruthValue *TruthValueAction(boolean value) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  TruthValue *newTruthValue = calloc(1, sizeof(TruthValue));
+  TruthValue *newTruthValue = _allocate(sizeof(TruthValue));
   newTruthValue->value = value;
   return newTruthValue;
 }
@@ -94,7 +150,8 @@ BinaryExpressionSemanticAction(Expression *leftExpression,
                                Expression *rightExpression,
                                BinaryOperatorType operatorType) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  BinaryExpression *binaryExpression = calloc(1, sizeof(BinaryExpression));
+  BinaryExpression *binaryExpression =
+      _allocateExpression(sizeof(BinaryExpression));
   binaryExpression->leftExpression = leftExpression;
   binaryExpression->rightExpression = rightExpression;
   binaryExpression->operatorType = operatorType;
@@ -104,15 +161,26 @@ BinaryExpressionSemanticAction(Expression *leftExpression,
 CustomExpression *
 PredefinedFormulaSemanticAction(PredefinedFormula predefinedFormula) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  CustomExpression *customExpression = calloc(1, sizeof(CustomExpression));
+  CustomExpression *customExpression =
+      _allocateExpression(sizeof(CustomExpression));
   customExpression->type = PREDEFINED_FORMULA;
   customExpression->predefinedFormula = predefinedFormula;
   return customExpression;
 }
 
+CustomOperator *ApplyCustomOperatorAction(const Identifier *name,
+                                          VariableList *argumentList) {
+  _logSyntacticAnalyzerAction(__FUNCTION__);
+  CustomOperator *application = _allocateExpression(sizeof(CustomOperator));
+  application->name = name;
+  application->variableList = argumentList;
+  return application;
+}
+
 CustomExpression *CustomOperatorSemanticAction(CustomOperator *customOperator) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  CustomExpression *customExpression = calloc(1, sizeof(CustomExpression));
+  CustomExpression *customExpression =
+      _allocateExpression(sizeof(CustomExpression));
   customExpression->type = CUSTOM_OPERATOR;
   customExpression->customOperator = customOperator;
   return customExpression;
@@ -120,14 +188,14 @@ CustomExpression *CustomOperatorSemanticAction(CustomOperator *customOperator) {
 
 NotExpression *NotExpressionSemanticAction(Expression *expression) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  NotExpression *notExpression = calloc(1, sizeof(NotExpression));
+  NotExpression *notExpression = _allocateExpression(sizeof(NotExpression));
   notExpression->expression = expression;
   return notExpression;
 }
 
 Expression *BinaryTypeAction(BinaryExpression *binaryExpression) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  Expression *expression = calloc(1, sizeof(Expression));
+  Expression *expression = _allocateExpression(sizeof(Expression));
   expression->binaryExpression = binaryExpression;
   expression->type = BINARY_EXPRESSION;
   return expression;
@@ -135,7 +203,7 @@ Expression *BinaryTypeAction(BinaryExpression *binaryExpression) {
 
 Expression *CustomTypeAction(CustomExpression *customExpression) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  Expression *expression = calloc(1, sizeof(Expression));
+  Expression *expression = _allocateExpression(sizeof(Expression));
   expression->customExpression = customExpression;
   expression->type = CUSTOM_EXPRESSION;
   return expression;
@@ -143,7 +211,7 @@ Expression *CustomTypeAction(CustomExpression *customExpression) {
 
 Expression *NotTypeAction(NotExpression *notExpression) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  Expression *expression = calloc(1, sizeof(Expression));
+  Expression *expression = _allocateExpression(sizeof(Expression));
   expression->notExpression = notExpression;
   expression->type = NOT_EXPRESSION;
   return expression;
@@ -151,7 +219,7 @@ Expression *NotTypeAction(NotExpression *notExpression) {
 
 Expression *VariableTypeAction(Variable variable) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  Expression *expression = calloc(1, sizeof(Expression));
+  Expression *expression = _allocateExpression(sizeof(Expression));
   expression->variable = variable;
   expression->type = VARIABLE_EXPRESSION;
   return expression;
@@ -160,24 +228,41 @@ Expression *VariableTypeAction(Variable variable) {
 VariableList *VariableListAction(VariableList *variableList,
                                  Variable variable) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  VariableList *newVariableList = calloc(1, sizeof(VariableList));
-  newVariableList->variable = variable;
-  newVariableList->next = variableList;
-  return newVariableList;
+  VariableList *list =
+      variableList == NULL ? _allocate(sizeof(VariableList)) : variableList;
+  list->variables = _grow(currentCompilerState()->arena, list->variables,
+                          list->count, &list->capacity, sizeof(Variable));
+  list->variables[list->count++] = variable;
+  return list;
+}
+
+VariableList *ArgumentListAction(VariableList *argumentList,
+                                 Variable variable) {
+  _logSyntacticAnalyzerAction(__FUNCTION__);
+  VariableList *list = argumentList == NULL
+                           ? _allocateExpression(sizeof(VariableList))
+                           : argumentList;
+  list->variables =
+      _grow(currentCompilerState()->expressionArena, list->variables,
+            list->count, &list->capacity, sizeof(Variable));
+  list->variables[list->count++] = variable;
+  return list;
 }
 
 ValuationList *ValuationListAction(ValuationList *valuationList,
                                    Valuation *valuation) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  ValuationList *newValuationList = calloc(1, sizeof(ValuationList));
-  newValuationList->valuation = valuation;
-  newValuationList->next = valuationList;
-  return newValuationList;
+  ValuationList *list =
+      valuationList == NULL ? _allocate(sizeof(ValuationList)) : valuationList;
+  list->valuations = _grow(currentCompilerState()->arena, list->valuations,
+                           list->count, &list->capacity, sizeof(Valuation *));
+  list->valuations[list->count++] = valuation;
+  return list;
 }
 
 Valuation *ValuationAction(Variable variable, TruthValue *truthValue) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  Valuation *valuation = calloc(1, sizeof(Valuation));
+  Valuation *valuation = _allocate(sizeof(Valuation));
   valuation->variable = variable;
   valuation->truthValue = truthValue;
   return valuation;
@@ -185,47 +270,72 @@ Valuation *ValuationAction(Variable variable, TruthValue *truthValue) {
 
 OpsetList *OpsetListAction(OpsetList *opsetList, Operator operator) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  OpsetList *newOpsetList = calloc(1, sizeof(OpsetList));
-  newOpsetList->operator= operator;
-  newOpsetList->next = opsetList;
-  return newOpsetList;
+  OpsetList *list =
+      opsetList == NULL ? _allocate(sizeof(OpsetList)) : opsetList;
+  list->operators = _grow(currentCompilerState()->arena, list->operators,
+                          list->count, &list->capacity, sizeof(Operator));
+  list->operators[list->count++] = operator;
+  return list;
 }
 
-EvaluateStatement *EvaluateFormulaAction(const char *formulaName,
-                                         const char *valuationName) {
+EvaluateStatement *EvaluateFormulaAction(const Identifier *formulaName,
+                                         const Identifier *valuationName) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  EvaluateStatement *evaluateStatement = calloc(1, sizeof(EvaluateStatement));
+  EvaluateStatement *evaluateStatement =
+      _allocateStatement(sizeof(EvaluateStatement));
   evaluateStatement->formulaName = formulaName;
   evaluateStatement->valuationName = valuationName;
   return evaluateStatement;
 }
 
-AdequateStatement *CheckAdequacyAction(const char *opsetName) {
+AdequateStatement *CheckAdequacyAction(const Identifier *opsetName) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  AdequateStatement *adequateStatement = calloc(1, sizeof(AdequateStatement));
+  AdequateStatement *adequateStatement =
+      _allocateStatement(sizeof(AdequateStatement));
   adequateStatement->opsetName = opsetName;
   return adequateStatement;
 }
 
+CongruenceStatement *CongruenceAction(const Identifier *leftFormulaName,
+                                      const Identifier *rightFormulaName) {
+  _logSyntacticAnalyzerAction(__FUNCTION__);
+  CongruenceStatement *congruenceStatement =
+      _allocateStatement(sizeof(CongruenceStatement));
+  congruenceStatement->leftFormulaName = leftFormulaName;
+  congruenceStatement->rightFormulaName = rightFormulaName;
+  return congruenceStatement;
+}
+
+FormulaAnalysisStatement *FormulaAnalysisAction(const Identifier *formulaName,
+                                                FormulaAnalysisType type) {
+  _logSyntacticAnalyzerAction(__FUNCTION__);
+  FormulaAnalysisStatement *formulaAnalysisStatement =
+      _allocateStatement(sizeof(FormulaAnalysisStatement));
+  formulaAnalysisStatement->formulaName = formulaName;
+  formulaAnalysisStatement->type = type;
+  return formulaAnalysisStatement;
+}
+
 DefineVariable *DefineVariableAction(VariableList *variableList) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  DefineVariable *defineVariable = calloc(1, sizeof(DefineVariable));
+  DefineVariable *defineVariable = _allocate(sizeof(DefineVariable));
   defineVariable->variableList = variableList;
   return defineVariable;
 }
 
-DefineFormula *DefineFormulaAction(const char *name, Expression *expression) {
+DefineFormula *DefineFormulaAction(const Identifier *name,
+                                   Expression *expression) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  DefineFormula *defineFormula = calloc(1, sizeof(DefineFormula));
+  DefineFormula *defineFormula = _allocate(sizeof(DefineFormula));
   defineFormula->name = name;
   defineFormula->expression = expression;
   return defineFormula;
 }
 
-DefineValuation *DefineValuationAction(const char *name,
+DefineValuation *DefineValuationAction(const Identifier *name,
                                        ValuationList *valuationList) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  DefineValuation *defineValuation = calloc(1, sizeof(DefineValuation));
+  DefineValuation *defineValuation = _allocate(sizeof(DefineValuation));
   defineValuation->name = name;
   defineValuation->valuationList = valuationList;
   return defineValuation;
@@ -234,24 +344,25 @@ DefineValuation *DefineValuationAction(const char *name,
 DefineOperator *DefineOperatorAction(CustomOperator *customOperator,
                                      TruthTable *truthTable) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  DefineOperator *defineOperator = calloc(1, sizeof(DefineOperator));
+  DefineOperator *defineOperator = _allocate(sizeof(DefineOperator));
   defineOperator->customOperator = customOperator;
   defineOperator->truthTable = truthTable;
   return defineOperator;
 }
 
-CustomOperator *DefineCustomOperatorAction(const char *name,
+CustomOperator *DefineCustomOperatorAction(const Identifier *name,
                                            VariableList *variableList) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  CustomOperator *customOperator = calloc(1, sizeof(CustomOperator));
+  CustomOperator *customOperator = _allocate(sizeof(CustomOperator));
   customOperator->name = name;
   customOperator->variableList = variableList;
   return customOperator;
 }
 
-DefineOpset *DefineOpsetAction(const char *name, OpsetList *opsetList) {
+DefineOpset *DefineOpsetAction(const Identifier *name,
+                               OpsetList *opsetList) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  DefineOpset *defineOpset = calloc(1, sizeof(DefineOpset));
+  DefineOpset *defineOpset = _allocate(sizeof(DefineOpset));
   defineOpset->name = name;
   defineOpset->opsetList = opsetList;
   return defineOpset;
@@ -260,7 +371,7 @@ DefineOpset *DefineOpsetAction(const char *name, OpsetList *opsetList) {
 Statement *
 DefineVariableStatementSemanticAction(DefineVariable *defineVariable) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  Statement *statement = calloc(1, sizeof(Statement));
+  Statement *statement = _allocateStatement(sizeof(Statement));
   statement->defineVariable = defineVariable;
   statement->type = DEFINE_VARIABLE;
   return statement;
@@ -268,7 +379,7 @@ DefineVariableStatementSemanticAction(DefineVariable *defineVariable) {
 
 Statement *DefineFormulaStatementSemanticAction(DefineFormula *defineFormula) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  Statement *statement = calloc(1, sizeof(Statement));
+  Statement *statement = _allocateStatement(sizeof(Statement));
   statement->defineFormula = defineFormula;
   statement->type = DEFINE_FORMULA;
   return statement;
@@ -277,7 +388,7 @@ Statement *DefineFormulaStatementSemanticAction(DefineFormula *defineFormula) {
 Statement *
 DefineValuationStatementSemanticAction(DefineValuation *defineValuation) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  Statement *statement = calloc(1, sizeof(Statement));
+  Statement *statement = _allocateStatement(sizeof(Statement));
   statement->defineValuation = defineValuation;
   statement->type = DEFINE_VALUATION;
   return statement;
@@ -286,7 +397,7 @@ DefineValuationStatementSemanticAction(DefineValuation *defineValuation) {
 Statement *
 DefineOperatorStatementSemanticAction(DefineOperator *defineOperator) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  Statement *statement = calloc(1, sizeof(Statement));
+  Statement *statement = _allocateStatement(sizeof(Statement));
   statement->defineOperator = defineOperator;
   statement->type = DEFINE_OPERATOR;
   return statement;
@@ -294,7 +405,7 @@ DefineOperatorStatementSemanticAction(DefineOperator *defineOperator) {
 
 Statement *DefineOpsetStatementSemanticAction(DefineOpset *defineOpset) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  Statement *statement = calloc(1, sizeof(Statement));
+  Statement *statement = _allocateStatement(sizeof(Statement));
   statement->defineOpset = defineOpset;
   statement->type = DEFINE_OPSET;
   return statement;
@@ -303,7 +414,7 @@ Statement *DefineOpsetStatementSemanticAction(DefineOpset *defineOpset) {
 Statement *
 EvaluateStatementSemanticAction(EvaluateStatement *evaluateStatement) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  Statement *statement = calloc(1, sizeof(Statement));
+  Statement *statement = _allocateStatement(sizeof(Statement));
   statement->evaluateStatement = evaluateStatement;
   statement->type = EVALUATE_STATEMENT;
   return statement;
@@ -312,19 +423,47 @@ EvaluateStatementSemanticAction(EvaluateStatement *evaluateStatement) {
 Statement *
 AdequateStatementSemanticAction(AdequateStatement *adequateStatement) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  Statement *statement = calloc(1, sizeof(Statement));
+  Statement *statement = _allocateStatement(sizeof(Statement));
   statement->adequateStatement = adequateStatement;
   statement->type = ADEQUATE_STATEMENT;
   return statement;
 }
 
+Statement *FormulaAnalysisStatementSemanticAction(
+    FormulaAnalysisStatement *formulaAnalysisStatement) {
+  _logSyntacticAnalyzerAction(__FUNCTION__);
+  Statement *statement = _allocateStatement(sizeof(Statement));
+  statement->formulaAnalysisStatement = formulaAnalysisStatement;
+  statement->type = FORMULA_ANALYSIS_STATEMENT;
+  return statement;
+}
+
+Statement *
+CongruenceStatementSemanticAction(CongruenceStatement *congruenceStatement) {
+  _logSyntacticAnalyzerAction(__FUNCTION__);
+  Statement *statement = _allocateStatement(sizeof(Statement));
+  statement->congruenceStatement = congruenceStatement;
+  statement->type = CONGRUENCE_STATEMENT;
+  return statement;
+}
+
 Program *ProgramStatementSemanticAction(CompilerState *compilerState,
-                                        Program *nextProgram,
+                                        Program *program,
                                         Statement *statement) {
   _logSyntacticAnalyzerAction(__FUNCTION__);
-  Program *program = calloc(1, sizeof(Program));
-  program->statement = statement;
-  program->next = nextProgram;
+  if (program == NULL) {
+    program = _allocate(sizeof(Program));
+  }
+  if (compilerState->statementHandler != NULL) {
+    // In streaming mode, the program stays empty.
+    compilerState->statementHandler(compilerState, statement,
+                                    compilerState->statementContext);
+  } else {
+    program->statements =
+        _grow(compilerState->arena, program->statements, program->count,
+              &program->capacity, sizeof(Statement *));
+    program->statements[program->count++] = statement;
+  }
 
   compilerState->abstractSyntaxtTree = program;
   if (0 < flexCurrentContext()) {
@@ -43,6 +43,9 @@ BinaryExpressionSemanticAction(Expression *leftExpression,
 CustomExpression *
 PredefinedFormulaSemanticAction(PredefinedFormula predefinedFormula);
 
+CustomOperator *ApplyCustomOperatorAction(const Identifier *name,
+                                          VariableList *argumentList);
+
 CustomExpression *CustomOperatorSemanticAction(CustomOperator *customOperator);
 
 NotExpression *NotExpressionSemanticAction(Expression *expression);
@@ -57,6 +60,9 @@ Expression *VariableTypeAction(Variable variable);
 
 VariableList *VariableListAction(VariableList *variableList, Variable variable);
 
+VariableList *ArgumentListAction(VariableList *argumentList,
+                                 Variable variable);
+
 ValuationList *ValuationListAction(ValuationList *valuationList,
                                    Valuation *valuation);
 
@@ -64,25 +70,33 @@ Valuation *ValuationAction(Variable variable, TruthValue *truthValue);
 
 OpsetList *OpsetListAction(OpsetList *opsetList, Operator operator);
 
-EvaluateStatement *EvaluateFormulaAction(const char *formulaName,
-                                         const char *valuationName);
+EvaluateStatement *EvaluateFormulaAction(const Identifier *formulaName,
+                                         const Identifier *valuationName);
+
+AdequateStatement *CheckAdequacyAction(const Identifier *opsetName);
+
+CongruenceStatement *CongruenceAction(const Identifier *leftFormulaName,
+                                      const Identifier *rightFormulaName);
 
-AdequateStatement *CheckAdequacyAction(const char *opsetName);
+FormulaAnalysisStatement *FormulaAnalysisAction(const Identifier *formulaName,
+                                                FormulaAnalysisType type);
 
 DefineVariable *DefineVariableAction(VariableList *variableList);
 
-DefineFormula *DefineFormulaAction(const char *name, Expression *expression);
+DefineFormula *DefineFormulaAction(const Identifier *name,
+                                   Expression *expression);
 
-DefineValuation *DefineValuationAction(const char *name,
+DefineValuation *DefineValuationAction(const Identifier *name,
                                        ValuationList *valuationList);
 
 DefineOperator *DefineOperatorAction(CustomOperator *customOperator,
                                      TruthTable *truthTable);
 
-CustomOperator *DefineCustomOperatorAction(const char *name,
+CustomOperator *DefineCustomOperatorAction(const Identifier *name,
                                            VariableList *variableList);
 
-DefineOpset *DefineOpsetAction(const char *name, OpsetList *opsetList);
+DefineOpset *DefineOpsetAction(const Identifier *name,
+                               OpsetList *opsetList);
 
 Statement *
 DefineVariableStatementSemanticAction(DefineVariable *defineVariable);
@@ -103,8 +117,14 @@ EvaluateStatementSemanticAction(EvaluateStatement *evaluateStatement);
 Statement *
 AdequateStatementSemanticAction(AdequateStatement *adequateStatement);
 
+Statement *FormulaAnalysisStatementSemanticAction(
+    FormulaAnalysisStatement *formulaAnalysisStatement);
+
+Statement *
+CongruenceStatementSemanticAction(CongruenceStatement *congruenceStatement);
+
 Program *ProgramStatementSemanticAction(CompilerState *compilerState,
-                                        Program *nextProgram,
+                                        Program *program,
                                         Statement *statement);
 
 #endif
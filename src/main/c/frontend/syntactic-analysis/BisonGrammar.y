@@ -2,6 +2,16 @@
 #include "BisonActions.h"
 #include "AbstractSyntaxTree.h"
 #include "../../shared/Type.h"
+
+/**
+ * The maximum depth of the stack of the parser, which starts small and grows
+ * on demand (in heap-memory) up to this depth. Every nested expression takes
+ * a few entries, so the default of Bison (10000) rejects formulas nested only
+ * some thousands of levels. CMake defines it with the PARSER_MAX_DEPTH option.
+ */
+#ifndef YYMAXDEPTH
+#define YYMAXDEPTH 10000000
+#endif
 %}
 
 // You touch this, and you die.
@@ -11,6 +21,7 @@
     /** Terminals. */
     boolean truth_value;     // Para valores booleanos (TRUE o FALSE).
     const char * keywordOrSymbol;       // Para tokens generales.
+    const Identifier * identifier;      // Para identificadores y conectivos (internados).
 
     /** Non-terminals. */
     Program *program;     // Representa el programa completo.
@@ -36,62 +47,25 @@
     DefineOpset *defineOpset; // Declaración de conjuntos de operadores.
     EvaluateStatement *evaluateStatement; // Evaluación de una fórmula.
     AdequateStatement *adequateStatement; // Verificación de adecuación.
+    FormulaAnalysisStatement *formulaAnalysisStatement; // Análisis de una fórmula.
+    CongruenceStatement *congruenceStatement; // Congruencia semántica de dos fórmulas.
 	//LexicalAnalyzerContext *lexicalAnalizerContext; // Contexto del analizador léxico.
 }
 
 /**
- * Destructors. This functions are executed after the parsing ends, so if the
- * AST must be used in the following phases of the compiler you shouldn't used
- * this approach. To use this mechanism, the AST must be translated into
- * another structure.
+ * Destructors. There are none: every node of the AST is allocated inside the
+ * arena of the compiler state, so the symbols discarded by Bison during the
+ * error recovery are released along with that arena, after the parsing ends,
+ * in the same way as the nodes of an accepted program.
  *
  * @see https://www.gnu.org/software/bison/manual/html_node/Destructor-Decl.html
  */
 
-
-%destructor { releaseProgram($$); } <program>
-%destructor { releaseStatement($$); } <statement>
-
-%destructor { releaseExpression($$); } <expression>
-%destructor { releaseBinaryExpression($$); } <binaryExpression>
-%destructor { releaseCustomExpression($$); } <customExpression>
-%destructor { releaseNotExpression($$); } <notExpression>
-
-%destructor { releaseVariableList($$); } <variableList>
-%destructor { releaseDefineVariable($$); } <defineVariable>
-
-%destructor { releaseDefineFormula($$); } <defineFormula>
-
-%destructor { releaseDefineValuation($$); } <defineValuation>
-%destructor { releaseValuationList($$); } <valuationList>
-%destructor { releaseValuation($$); } <valuation>
-
-
-%destructor { releaseOpsetList($$); } <opsetList>
-%destructor { releaseDefineOpset($$); } <defineOpset>
-
-%destructor { releaseDefineOperator($$); } <defineOperator>
-%destructor { releaseCustomOperator($$); } <customOperator>
-
-%destructor { releaseEvaluateStatement($$); } <evaluateStatement>
-%destructor { releaseAdequateStatement($$); } <adequateStatement>
-
-
-%destructor { releaseTruthTable($$); } <truthTable>
-%destructor { releaseTruthTableEntry($$); } <truthTableEntry>
-%destructor { releaseTruthValueList($$); } <truthValueList>
-%destructor { releaseTruthValueOrWildcard($$); } <truthValueOrWildcard>
-%destructor { releaseTruthValue($$); } <truthValue>
-
-//%destructor { destroyLexicalAnalyzerContext($$); } <lexicalAnalizerContext>
-
-
-
-
 /** Terminals. */
 %token <keywordOrSymbol> DEFINE VARIABLE FORMULA VALUATION OPERATOR OPSET EVALUATE ADEQUATE OTHERWISE
-%token <keywordOrSymbol> AND OR THEN IFF NOT
-%token <keywordOrSymbol> IDENTIFIER
+%token <keywordOrSymbol> CLASSIFY MODELS CNF CONGRUENT COUNT COMPLEXITY
+%token <identifier> AND OR THEN IFF NOT
+%token <identifier> IDENTIFIER
 %token <keywordOrSymbol> EQUALS OPEN_BRACE CLOSE_BRACE OPEN_PARENTHESIS CLOSE_PARENTHESIS COMMA SEMICOLON ARROW WILDCARD DOLLAR
 %token <truth_value> TRUE FALSE
 %token <keywordOrSymbol> UNKNOWN
@@ -104,6 +78,7 @@
 %type <notExpression> notExpression
 %type <statement> statement
 %type <variableList> variableList
+%type <variableList> argumentList
 %type <valuationList> valuationList
 %type <valuation> valuation
 %type <truthTable> truthTable
@@ -119,7 +94,10 @@
 %type <defineOpset> defineOpset
 %type <evaluateStatement> evaluateStatement
 %type <adequateStatement> adequateStatement
+%type <formulaAnalysisStatement> formulaAnalysisStatement
+%type <congruenceStatement> congruenceStatement
 %type <customOperator> customOperator
+%type <customOperator> operatorApplication
 
 /**
  * Precedence and associativity.
@@ -145,6 +123,8 @@ statement: defineVariable																			{ $$ = DefineVariableStatementSemant
 	| defineOpset 																					{ $$ = DefineOpsetStatementSemanticAction($1); }
 	| evaluateStatement 																			{ $$ = EvaluateStatementSemanticAction($1); }
 	| adequateStatement 																			{ $$ = AdequateStatementSemanticAction($1); }
+	| formulaAnalysisStatement																		{ $$ = FormulaAnalysisStatementSemanticAction($1); }
+	| congruenceStatement																			{ $$ = CongruenceStatementSemanticAction($1); }
 	;
 
 defineVariable: DEFINE VARIABLE variableList			    										{ $$ = DefineVariableAction($3); }
@@ -216,6 +196,16 @@ evaluateStatement: EVALUATE OPEN_PARENTHESIS IDENTIFIER COMMA IDENTIFIER CLOSE_P
 adequateStatement: ADEQUATE OPEN_PARENTHESIS IDENTIFIER CLOSE_PARENTHESIS							{ $$ = CheckAdequacyAction($3); }
 	;
 
+formulaAnalysisStatement: CLASSIFY OPEN_PARENTHESIS IDENTIFIER CLOSE_PARENTHESIS					{ $$ = FormulaAnalysisAction($3, CLASSIFY_ANALYSIS); }
+	| MODELS OPEN_PARENTHESIS IDENTIFIER CLOSE_PARENTHESIS											{ $$ = FormulaAnalysisAction($3, MODELS_ANALYSIS); }
+	| CNF OPEN_PARENTHESIS IDENTIFIER CLOSE_PARENTHESIS												{ $$ = FormulaAnalysisAction($3, CNF_ANALYSIS); }
+	| COUNT OPEN_PARENTHESIS IDENTIFIER CLOSE_PARENTHESIS											{ $$ = FormulaAnalysisAction($3, COUNT_ANALYSIS); }
+	| COMPLEXITY OPEN_PARENTHESIS IDENTIFIER CLOSE_PARENTHESIS										{ $$ = FormulaAnalysisAction($3, COMPLEXITY_ANALYSIS); }
+	;
+
+congruenceStatement: CONGRUENT OPEN_PARENTHESIS IDENTIFIER COMMA IDENTIFIER CLOSE_PARENTHESIS		{ $$ = CongruenceAction($3, $5); }
+	;
+
 expression: binaryExpression																		{ $$ = BinaryTypeAction($1); }
 	| customExpression																				{ $$ = CustomTypeAction($1); }
     | notExpression 																				{ $$ = NotTypeAction($1); }
@@ -229,7 +219,14 @@ binaryExpression: OPEN_PARENTHESIS expression[left] AND expression[right] CLOSE_
     ;
 
 customExpression: DOLLAR OPEN_BRACE IDENTIFIER CLOSE_BRACE 											{ $$ = PredefinedFormulaSemanticAction($3); }
-	| customOperator																				{ $$ = CustomOperatorSemanticAction($1); }	 																		
+	| operatorApplication																			{ $$ = CustomOperatorSemanticAction($1); }	 																		
+	;
+
+operatorApplication: IDENTIFIER OPEN_PARENTHESIS argumentList CLOSE_PARENTHESIS						{ $$ = ApplyCustomOperatorAction($1, $3); }
+	;
+
+argumentList: IDENTIFIER 																			{ $$ = ArgumentListAction(NULL, $1); }
+	| argumentList COMMA IDENTIFIER 																{ $$ = ArgumentListAction($1, $3); }
 	;
 
 notExpression: NOT expression 																		{ $$ = NotExpressionSemanticAction($2); }
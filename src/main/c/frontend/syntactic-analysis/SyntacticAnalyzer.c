@@ -18,7 +18,7 @@ void shutdownSyntacticAnalyzerModule() {
 
 /** IMPORTED FUNCTIONS */
 
-extern LexicalAnalyzerContext * createLexicalAnalyzerContext();
+extern LexicalAnalyzerContext createLexicalAnalyzerContext();
 
 /**
  * Bison exported functions.
@@ -35,9 +35,8 @@ extern int yyparse(void);
 
 // Bison error-reporting function.
 void yyerror(const char * string) {
-	LexicalAnalyzerContext * lexicalAnalyzerContext = createLexicalAnalyzerContext();
-	logError(_logger, "Syntax error (on line %d).", lexicalAnalyzerContext->line);
-	destroyLexicalAnalyzerContext(lexicalAnalyzerContext);
+	LexicalAnalyzerContext lexicalAnalyzerContext = createLexicalAnalyzerContext();
+	logError(_logger, "Syntax error (on line %d).", lexicalAnalyzerContext.line);
 }
 
 /* PUBLIC FUNCTIONS */
@@ -0,0 +1,133 @@
+#include "Arena.h"
+
+/**
+ * A contiguous chunk of memory of an arena. Blocks are chained from the most
+ * recent to the oldest one.
+ */
+struct ArenaBlock {
+	ArenaBlock * previous;
+	size_t capacity;
+	size_t used;
+	char * data;
+};
+
+/* PRIVATE FUNCTIONS */
+
+static size_t _align(const size_t size);
+static ArenaBlock * _createArenaBlock(const size_t capacity);
+
+/**
+ * Rounds up a size to the next multiple of the arena alignment.
+ */
+static size_t _align(const size_t size) {
+	return (size + ARENA_ALIGNMENT - 1) & ~((size_t) ARENA_ALIGNMENT - 1);
+}
+
+/**
+ * Creates a new block with the specified capacity. The block header and its
+ * data are requested together with "calloc", so every allocation served from
+ * a fresh block is already zero-initialized.
+ */
+static ArenaBlock * _createArenaBlock(const size_t capacity) {
+	const size_t headerSize = _align(sizeof(ArenaBlock));
+	ArenaBlock * block = calloc(1, headerSize + capacity);
+	if (block == NULL) {
+		return NULL;
+	}
+	block->capacity = capacity;
+	block->data = ((char *) block) + headerSize;
+	return block;
+}
+
+/* PUBLIC FUNCTIONS */
+
+Arena * createArena(const size_t blockSize) {
+	Arena * arena = calloc(1, sizeof(Arena));
+	arena->blockSize = _align(blockSize);
+	return arena;
+}
+
+void destroyArena(Arena * arena) {
+	if (arena != NULL) {
+		ArenaBlock * block = arena->block;
+		while (block != NULL) {
+			ArenaBlock * previous = block->previous;
+			free(block);
+			block = previous;
+		}
+		free(arena);
+	}
+}
+
+void resetArena(Arena * arena) {
+	ArenaBlock * block = arena->block;
+	if (block != NULL) {
+		ArenaBlock * previous = block->previous;
+		while (previous != NULL) {
+			ArenaBlock * next = previous->previous;
+			free(previous);
+			previous = next;
+		}
+		memset(block->data, 0, block->used);
+		block->used = 0;
+		block->previous = NULL;
+		arena->blocks = 1;
+		arena->allocatedBytes = 0;
+	}
+}
+
+void * allocateInArena(Arena * arena, const size_t count, const size_t size) {
+	const size_t bytes = _align(count * size);
+	ArenaBlock * block = arena->block;
+	if (block == NULL || block->capacity - block->used < bytes) {
+		if (arena->blockSize / 4 < bytes) {
+			// Big objects get their own block, behind the current one, so
+			// the free space of the current block is not wasted.
+			ArenaBlock * dedicatedBlock = _createArenaBlock(bytes);
+			if (dedicatedBlock == NULL) {
+				return NULL;
+			}
+			if (block == NULL) {
+				arena->block = dedicatedBlock;
+			}
+			else {
+				dedicatedBlock->previous = block->previous;
+				block->previous = dedicatedBlock;
+			}
+			dedicatedBlock->used = bytes;
+			++arena->blocks;
+			arena->allocatedBytes += bytes;
+			return dedicatedBlock->data;
+		}
+		block = _createArenaBlock(arena->blockSize);
+		if (block == NULL) {
+			return NULL;
+		}
+		block->previous = arena->block;
+		arena->block = block;
+		++arena->blocks;
+	}
+	void * memory = block->data + block->used;
+	block->used += bytes;
+	arena->allocatedBytes += bytes;
+	return memory;
+}
+
+void * reallocateInArena(Arena * arena, void * memory, const size_t count, const size_t newCount, const size_t size) {
+	ArenaBlock * block = arena->block;
+	const size_t bytes = _align(count * size);
+	const size_t newBytes = _align(newCount * size);
+	if (memory != NULL && block != NULL && (char *) memory + bytes == block->data + block->used
+		&& newBytes - bytes <= block->capacity - block->used) {
+		// The array is the last allocation of the current block, so it grows
+		// in place (the free space of a block is still zero-initialized).
+		block->used += newBytes - bytes;
+		arena->allocatedBytes += newBytes - bytes;
+		return memory;
+	}
+	void * newMemory = allocateInArena(arena, newCount, size);
+	if (newMemory != NULL && memory != NULL) {
+		memcpy(newMemory, memory, count * size);
+	}
+	return newMemory;
+}
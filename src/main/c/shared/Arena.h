@@ -0,0 +1,68 @@
+#ifndef ARENA_HEADER
+#define ARENA_HEADER
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * The default size of every block of an arena (in bytes). Allocations
+ * greater than a quarter of this size get a dedicated block.
+ */
+#define DEFAULT_ARENA_BLOCK_SIZE (64 * 1024)
+
+/**
+ * The alignment of every allocation served by an arena (in bytes), enough
+ * for any scalar type of the platform.
+ */
+#define ARENA_ALIGNMENT 16
+
+typedef struct ArenaBlock ArenaBlock;
+
+/**
+ * A region-based allocator. Objects are carved out of large blocks, and the
+ * entire region is released at once, in O(number of blocks), so individual
+ * objects are never freed (nor traversed) one by one.
+ */
+typedef struct {
+	ArenaBlock * block;
+	size_t blockSize;
+	size_t blocks;
+	size_t allocatedBytes;
+} Arena;
+
+/**
+ * Creates a new empty arena, which will request memory in blocks of the
+ * specified size (in bytes).
+ */
+Arena * createArena(const size_t blockSize);
+
+/**
+ * Destroy an arena, releasing every object ever allocated inside it.
+ */
+void destroyArena(Arena * arena);
+
+/**
+ * Releases every object allocated inside an arena, but keeps its most recent
+ * block (zeroing the part in use), so an arena reset after each unit of work
+ * (e.g., a statement) doesn't request memory again for every unit.
+ */
+void resetArena(Arena * arena);
+
+/**
+ * Allocates an array of "count" elements of "size" bytes each inside the
+ * arena. Like "calloc", the memory is zero-initialized. The memory cannot be
+ * released individually: it lives as long as the arena.
+ */
+void * allocateInArena(Arena * arena, const size_t count, const size_t size);
+
+/**
+ * Grows an array of the arena from "count" to "newCount" elements of "size"
+ * bytes each (the new elements are zero-initialized). If the array is the
+ * last allocation of the arena and there is room after it, it grows in place;
+ * otherwise, it's copied to a new allocation (and the old one is wasted until
+ * the arena is destroyed, so the arrays should double their capacity).
+ */
+void * reallocateInArena(Arena * arena, void * memory, const size_t count, const size_t newCount, const size_t size);
+
+#endif
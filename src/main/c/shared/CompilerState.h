@@ -1,6 +1,8 @@
 #ifndef COMPILER_STATE_HEADER
 #define COMPILER_STATE_HEADER
 
+#include "Arena.h"
+#include "SymbolTable.h"
 #include "Type.h"
 
 /**
@@ -11,24 +13,45 @@ typedef enum {
 	FAILED = 1
 } CompilationStatus;
 
+typedef struct CompilerState CompilerState;
+
 /**
  * The global state of the compiler. Should transport every data structure
  * needed across the different phases of a compilation.
  */
-typedef struct {
+struct CompilerState {
 	// The root node of the AST.
 	void * abstractSyntaxtTree;
 
+	// The region where the definitions of the AST are allocated (every node,
+	// but the expressions and the statements).
+	Arena * arena;
+
+	// The region of the expressions of the formulas, which is released as
+	// soon as they are lowered into the DAG (or NULL, after that). In
+	// streaming mode, it's reset after each statement instead.
+	Arena * expressionArena;
+
+	// The region of the statements, and of the nodes of the statements that
+	// define nothing. In streaming mode, it's reset after each statement, so
+	// only the definitions outlive their statement.
+	Arena * statementArena;
+
+	// In streaming mode, the function that analyzes and executes each
+	// statement as soon as it's reduced, instead of appending it to the
+	// program, and its context (otherwise, both are NULL).
+	void (* statementHandler)(CompilerState * compilerState, void * statement, void * context);
+	void * statementContext;
+
 	// A flag that indicates the current state of the compilation so far.
 	boolean succeed;
 
+	// Every definition of the program, by kind and name.
+	SymbolTable * symbolTable;
+
 	// TODO: Add an stack to handle nested scopes.
-	// TODO: Add a symbol table.
 	// TODO: Add configuration.
 	// TODO: ...
-
-	// The computed value of the entire program (only for the calculator).
-	int value;
-} CompilerState;
+};
 
 #endif
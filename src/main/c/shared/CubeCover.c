@@ -0,0 +1,94 @@
+#include "CubeCover.h"
+
+/* PRIVATE FUNCTIONS */
+
+static boolean _splitRegion(const Cube * cubes, const unsigned int count, const Cube region, CubeCover * uncovered, uint64_t * input);
+
+/**
+ * Splits a region over the cubes that intersect it, collecting the cubes of
+ * the region out of every one of them (or, without a cover to collect them,
+ * stopping at the first uncovered input). Returns true if some input was
+ * uncovered.
+ */
+static boolean _splitRegion(const Cube * cubes, const unsigned int count, const Cube region, CubeCover * uncovered, uint64_t * input) {
+	Cube * inside = malloc((1 + count) * sizeof(Cube));
+	unsigned int insideCount = 0;
+	for (unsigned int k = 0; k < count; ++k) {
+		if (cubeContains(cubes[k], region)) {
+			free(inside);
+			return false;
+		}
+		if (cubesIntersect(cubes[k], region)) {
+			inside[insideCount++] = cubes[k];
+		}
+	}
+	boolean found = false;
+	if (insideCount == 0) {
+		if (uncovered != NULL) {
+			addCube(uncovered, region);
+		}
+		else {
+			*input = region.values;
+		}
+		found = true;
+	}
+	else {
+		// Splits on an argument of the first cube that the region leaves free,
+		// so one of the halves leaves that cube behind.
+		const uint64_t split = inside[0].care & ~region.care & -(inside[0].care & ~region.care);
+		for (uint64_t value = 0; value < 2 && (uncovered != NULL || !found); ++value) {
+			const Cube half = {.care = region.care | split, .values = region.values | (value ? split : 0)};
+			found = _splitRegion(inside, insideCount, half, uncovered, input) || found;
+		}
+	}
+	free(inside);
+	return found;
+}
+
+/* PUBLIC FUNCTIONS */
+
+CubeCover * createCubeCover() {
+	return calloc(1, sizeof(CubeCover));
+}
+
+void destroyCubeCover(CubeCover * cubeCover) {
+	if (cubeCover != NULL) {
+		free(cubeCover->cubes);
+		free(cubeCover);
+	}
+}
+
+void addCube(CubeCover * cubeCover, const Cube cube) {
+	if (cubeCover->count == cubeCover->capacity) {
+		cubeCover->capacity = cubeCover->capacity == 0 ? 8 : 2 * cubeCover->capacity;
+		cubeCover->cubes = realloc(cubeCover->cubes, cubeCover->capacity * sizeof(Cube));
+	}
+	cubeCover->cubes[cubeCover->count++] = cube;
+}
+
+boolean cubesIntersect(const Cube cube, const Cube other) {
+	return ((cube.values ^ other.values) & cube.care & other.care) == 0;
+}
+
+boolean cubeContains(const Cube cube, const Cube subcube) {
+	return (cube.care & ~subcube.care) == 0 && ((cube.values ^ subcube.values) & cube.care) == 0;
+}
+
+boolean coverMatches(const CubeCover * cubeCover, const uint64_t input) {
+	for (unsigned int k = 0; k < cubeCover->count; ++k) {
+		if (((input ^ cubeCover->cubes[k].values) & cubeCover->cubes[k].care) == 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+boolean findUncoveredInput(const CubeCover * cubeCover, const Cube region, uint64_t * input) {
+	return _splitRegion(cubeCover->cubes, cubeCover->count, region, NULL, input);
+}
+
+CubeCover * complementCover(const CubeCover * cubeCover, const Cube region) {
+	CubeCover * complement = createCubeCover();
+	_splitRegion(cubeCover->cubes, cubeCover->count, region, complement, NULL);
+	return complement;
+}
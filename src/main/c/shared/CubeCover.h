@@ -0,0 +1,73 @@
+#ifndef CUBE_COVER_HEADER
+#define CUBE_COVER_HEADER
+
+#include "Type.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * A cube over the arguments of a function of up to 64 arguments: the inputs
+ * where every argument whose bit is set in "care" takes its bit of "values"
+ * (the rest of the arguments are free, and their bits of "values" are 0). The
+ * cube without cares holds every input.
+ */
+typedef struct {
+	uint64_t care;
+	uint64_t values;
+} Cube;
+
+/**
+ * A sum of products: the inputs of a function that are in some of its cubes.
+ */
+typedef struct {
+	Cube * cubes;
+	unsigned int count;
+	unsigned int capacity;
+} CubeCover;
+
+/**
+ * Creates an empty cover, without inputs.
+ */
+CubeCover * createCubeCover();
+
+/**
+ * Destroy a cover.
+ */
+void destroyCubeCover(CubeCover * cubeCover);
+
+/**
+ * Appends a cube to a cover.
+ */
+void addCube(CubeCover * cubeCover, const Cube cube);
+
+/**
+ * Returns true if 2 cubes share an input.
+ */
+boolean cubesIntersect(const Cube cube, const Cube other);
+
+/**
+ * Returns true if every input of the subcube is an input of the cube.
+ */
+boolean cubeContains(const Cube cube, const Cube subcube);
+
+/**
+ * Returns true if some cube of a cover holds the input.
+ */
+boolean coverMatches(const CubeCover * cubeCover, const uint64_t input);
+
+/**
+ * Returns true if some input of a region is out of every cube of a cover,
+ * and writes the first one found (a tautology check, when the region holds
+ * every input). The region is split recursively on the arguments that the
+ * cubes care about, until it's out of every cube or inside some of them.
+ */
+boolean findUncoveredInput(const CubeCover * cubeCover, const Cube region, uint64_t * input);
+
+/**
+ * The complement of a cover inside a region, as disjoint cubes (using
+ * heap-memory), splitting the region as "findUncoveredInput" does.
+ */
+CubeCover * complementCover(const CubeCover * cubeCover, const Cube region);
+
+#endif
@@ -0,0 +1,120 @@
+#include "Identifier.h"
+
+/* MODULE INTERNAL STATE */
+
+#define INITIAL_POOL_CAPACITY 256
+
+// Where every identifier and its name are stored.
+static Arena * _arena = NULL;
+
+// Open-addressing hash table (linear probing), with a power-of-2 capacity.
+static Identifier ** _table = NULL;
+static unsigned int _tableCapacity = 0;
+
+// Identifiers by dense ID.
+static Identifier ** _identifiers = NULL;
+static unsigned int _identifiersCapacity = 0;
+static unsigned int _identifiersCount = 0;
+
+void initializeIdentifierModule() {
+	_arena = createArena(DEFAULT_ARENA_BLOCK_SIZE);
+	_tableCapacity = 2 * INITIAL_POOL_CAPACITY;
+	_table = calloc(_tableCapacity, sizeof(Identifier *));
+	_identifiersCapacity = INITIAL_POOL_CAPACITY;
+	_identifiers = calloc(_identifiersCapacity, sizeof(Identifier *));
+	_identifiersCount = 0;
+}
+
+void shutdownIdentifierModule() {
+	if (_arena != NULL) {
+		destroyArena(_arena);
+		_arena = NULL;
+	}
+	free(_table);
+	free(_identifiers);
+	_table = NULL;
+	_identifiers = NULL;
+	_tableCapacity = 0;
+	_identifiersCapacity = 0;
+	_identifiersCount = 0;
+}
+
+/* PRIVATE FUNCTIONS */
+
+static uint32_t _hash(const char * lexeme, const unsigned int length);
+static void _growTable();
+
+/**
+ * The FNV-1a hash of a lexeme.
+ *
+ * @see http://www.isthe.com/chongo/tech/comp/fnv/index.html
+ */
+static uint32_t _hash(const char * lexeme, const unsigned int length) {
+	uint32_t hash = 2166136261u;
+	for (unsigned int k = 0; k < length; ++k) {
+		hash ^= (unsigned char) lexeme[k];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+/**
+ * Doubles the capacity of the hash table, re-inserting every identifier with
+ * its cached hash (names are never compared again).
+ */
+static void _growTable() {
+	const unsigned int capacity = 2 * _tableCapacity;
+	Identifier ** table = calloc(capacity, sizeof(Identifier *));
+	for (unsigned int k = 0; k < _identifiersCount; ++k) {
+		unsigned int slot = _identifiers[k]->hash & (capacity - 1);
+		while (table[slot] != NULL) {
+			slot = (slot + 1) & (capacity - 1);
+		}
+		table[slot] = _identifiers[k];
+	}
+	free(_table);
+	_table = table;
+	_tableCapacity = capacity;
+}
+
+/* PUBLIC FUNCTIONS */
+
+const Identifier * internIdentifier(const char * lexeme, const unsigned int length) {
+	const uint32_t hash = _hash(lexeme, length);
+	unsigned int slot = hash & (_tableCapacity - 1);
+	while (_table[slot] != NULL) {
+		const Identifier * identifier = _table[slot];
+		if (identifier->hash == hash
+			&& identifier->length == length
+			&& memcmp(identifier->name, lexeme, length) == 0) {
+			return identifier;
+		}
+		slot = (slot + 1) & (_tableCapacity - 1);
+	}
+	Identifier * identifier = allocateInArena(_arena, 1, sizeof(Identifier));
+	char * name = allocateInArena(_arena, 1 + length, sizeof(char));
+	memcpy(name, lexeme, length);
+	identifier->name = name;
+	identifier->length = length;
+	identifier->id = _identifiersCount;
+	identifier->hash = hash;
+	if (_identifiersCount == _identifiersCapacity) {
+		_identifiersCapacity *= 2;
+		_identifiers = realloc(_identifiers, _identifiersCapacity * sizeof(Identifier *));
+	}
+	_identifiers[_identifiersCount++] = identifier;
+	_table[slot] = identifier;
+	// Keeps the load factor under 1/2.
+	if (_tableCapacity < 2 * _identifiersCount) {
+		_growTable();
+	}
+	return identifier;
+}
+
+const Identifier * identifierById(const unsigned int id) {
+	return id < _identifiersCount ? _identifiers[id] : NULL;
+}
+
+unsigned int identifierCount() {
+	return _identifiersCount;
+}
@@ -0,0 +1,52 @@
+#ifndef IDENTIFIER_HEADER
+#define IDENTIFIER_HEADER
+
+#include "Arena.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Initialize module's internal state. */
+void initializeIdentifierModule();
+
+/** Shutdown module's internal state. */
+void shutdownIdentifierModule();
+
+/**
+ * An interned identifier. There is only one instance per distinct name, so
+ * two identifiers are equal if and only if their pointers (or their IDs) are
+ * equal. The instances are stable, and live until the module is shutdown.
+ */
+typedef struct {
+	// The name, null-terminated.
+	const char * name;
+
+	// The length of the name, in characters.
+	unsigned int length;
+
+	// A dense ID, in the range [0, identifierCount()), by order of creation.
+	unsigned int id;
+
+	// The hash of the name, used internally by the pool.
+	uint32_t hash;
+} Identifier;
+
+/**
+ * Returns the unique identifier with the specified name, creating it if this
+ * is the first occurrence. The lexeme is copied, only the first time, so it
+ * can be a view over a transient buffer (it does not need to be
+ * null-terminated).
+ */
+const Identifier * internIdentifier(const char * lexeme, const unsigned int length);
+
+/**
+ * Returns the identifier with the specified dense ID.
+ */
+const Identifier * identifierById(const unsigned int id);
+
+/**
+ * The amount of distinct identifiers interned so far.
+ */
+unsigned int identifierCount();
+
+#endif
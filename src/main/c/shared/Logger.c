@@ -4,23 +4,21 @@
 
 static void _log(const Logger * logger, const LoggingLevel loggingLevel, const char * const format, va_list arguments);
 static LoggingLevel _loggingLevelFromString(const char * loggingLevel);
-static void _logInStream(FILE * const stream, const char * const format, va_list arguments);
+static void _logInStream(FILE * const stream, const char * const context, const char * const name, const char * const format, va_list arguments);
 static const char * _toContextString(const LoggingLevel loggingLevel);
 
 /**
  * Logs a new message at the specified level, using a format string.
  */
 static void _log(const Logger * logger, const LoggingLevel loggingLevel, const char * const format, va_list arguments) {
-	if (logger->loggingLevel <= loggingLevel) {
+	if (isLoggable(logger, loggingLevel)) {
 		const char * context = _toContextString(loggingLevel);
-		char * effectiveFormat = concatenate(6, context, "[", logger->name, "] ", format, "\n");
 		if (ERROR <= loggingLevel) {
-			_logInStream(stderr, effectiveFormat, arguments);
+			_logInStream(stderr, context, logger->name, format, arguments);
 		}
 		else {
-			_logInStream(stdout, effectiveFormat, arguments);
+			_logInStream(stdout, context, logger->name, format, arguments);
 		}
-		free(effectiveFormat);
 	}
 }
 
@@ -38,12 +36,15 @@ static LoggingLevel _loggingLevelFromString(const char * loggingLevel) {
 }
 
 /**
- * Low-level logging function.
+ * Low-level logging function. The context and the name are written in place,
+ * so there is no need to build a new format string for every message.
  *
  * @see https://cplusplus.com/reference/cstdio/vfprintf/
  */
-static void _logInStream(FILE * const stream, const char * const format, va_list arguments) {
+static void _logInStream(FILE * const stream, const char * const context, const char * const name, const char * const format, va_list arguments) {
+	fprintf(stream, "%s[%s] ", context, name);
 	vfprintf(stream, format, arguments);
+	fputc('\n', stream);
 }
 
 /**
@@ -85,35 +86,35 @@ void destroyLogger(Logger * logger) {
 	}
 }
 
-void logCritical(const Logger * logger, const char * const format, ...) {
+void (logCritical)(const Logger * logger, const char * const format, ...) {
 	va_list arguments;
 	va_start(arguments, format);
 	_log(logger, CRITICAL, format, arguments);
 	va_end(arguments);
 }
 
-void logDebugging(const Logger * logger, const char * const format, ...) {
+void (logDebugging)(const Logger * logger, const char * const format, ...) {
 	va_list arguments;
 	va_start(arguments, format);
 	_log(logger, DEBUGGING, format, arguments);
 	va_end(arguments);
 }
 
-void logError(const Logger * logger, const char * const format, ...) {
+void (logError)(const Logger * logger, const char * const format, ...) {
 	va_list arguments;
 	va_start(arguments, format);
 	_log(logger, ERROR, format, arguments);
 	va_end(arguments);
 }
 
-void logInformation(const Logger * logger, const char * const format, ...) {
+void (logInformation)(const Logger * logger, const char * const format, ...) {
 	va_list arguments;
 	va_start(arguments, format);
 	_log(logger, INFORMATION, format, arguments);
 	va_end(arguments);
 }
 
-void logWarning(const Logger * logger, const char * const format, ...) {
+void (logWarning)(const Logger * logger, const char * const format, ...) {
 	va_list arguments;
 	va_start(arguments, format);
 	_log(logger, WARNING, format, arguments);
@@ -75,6 +75,25 @@ typedef struct {
 	char * name;
 } Logger;
 
+/**
+ * The minimum logging level compiled into the binary. Every call to a logging
+ * function below this level is removed at compile-time, arguments included.
+ * For example, define it as 20 (INFORMATION) in release builds to remove
+ * every DEBUGGING trace.
+ */
+#ifndef LOGGING_LEVEL_FLOOR
+#define LOGGING_LEVEL_FLOOR 0
+#endif
+
+/**
+ * Returns true if a message at the specified level would be visible with
+ * this logger. Use it to guard any expensive work done only to build the
+ * arguments of a log.
+ */
+static inline boolean isLoggable(const Logger * logger, const LoggingLevel loggingLevel) {
+	return LOGGING_LEVEL_FLOOR <= loggingLevel && logger->loggingLevel <= loggingLevel;
+}
+
 /**
  * Creates a new logger with the specified name. That name will be visible in
  * every line you log with this object.
@@ -86,19 +105,39 @@ Logger * createLogger(char * name);
  */
 void destroyLogger(Logger * logger);
 
+/**
+ * The logging functions are shadowed by macros of the same name, that check
+ * the level before the call, so the arguments are neither evaluated nor
+ * formatted when the level is disabled. Wrap the name between parenthesis to
+ * call the function directly.
+ */
+
+#define logCritical(logger, ...) _logIfLoggable(logger, CRITICAL, logCritical, __VA_ARGS__)
+#define logDebugging(logger, ...) _logIfLoggable(logger, DEBUGGING, logDebugging, __VA_ARGS__)
+#define logError(logger, ...) _logIfLoggable(logger, ERROR, logError, __VA_ARGS__)
+#define logInformation(logger, ...) _logIfLoggable(logger, INFORMATION, logInformation, __VA_ARGS__)
+#define logWarning(logger, ...) _logIfLoggable(logger, WARNING, logWarning, __VA_ARGS__)
+
+#define _logIfLoggable(logger, loggingLevel, function, ...) \
+	do { \
+		if (isLoggable(logger, loggingLevel)) { \
+			(function)(logger, __VA_ARGS__); \
+		} \
+	} while (0)
+
 /** Logs at CRITICAL level. */
-void logCritical(const Logger * logger, const char * const format, ...);
+void (logCritical)(const Logger * logger, const char * const format, ...);
 
 /** Logs at DEBUGGING level. */
-void logDebugging(const Logger * logger, const char * const format, ...);
+void (logDebugging)(const Logger * logger, const char * const format, ...);
 
 /** Logs at ERROR level. */
-void logError(const Logger * logger, const char * const format, ...);
+void (logError)(const Logger * logger, const char * const format, ...);
 
 /** Logs at INFORMATION level. */
-void logInformation(const Logger * logger, const char * const format, ...);
+void (logInformation)(const Logger * logger, const char * const format, ...);
 
 /** Logs at WARNING level. */
-void logWarning(const Logger * logger, const char * const format, ...);
+void (logWarning)(const Logger * logger, const char * const format, ...);
 
 #endif
@@ -0,0 +1,153 @@
+#include "Natural.h"
+
+/* PRIVATE FUNCTIONS */
+
+static void _reserve(Natural * natural, const unsigned int capacity);
+static void _trim(Natural * natural);
+
+/**
+ * Grows the limbs of a natural number to hold at least the specified amount
+ * of them.
+ */
+static void _reserve(Natural * natural, const unsigned int capacity) {
+	if (natural->capacity < capacity) {
+		natural->capacity = natural->capacity == 0 ? 4 : natural->capacity;
+		while (natural->capacity < capacity) {
+			natural->capacity *= 2;
+		}
+		natural->limbs = realloc(natural->limbs, natural->capacity * sizeof(uint32_t));
+	}
+}
+
+/**
+ * Drops the leading zero limbs.
+ */
+static void _trim(Natural * natural) {
+	while (0 < natural->count && natural->limbs[natural->count - 1] == 0) {
+		--natural->count;
+	}
+}
+
+/* PUBLIC FUNCTIONS */
+
+Natural * createNatural(const uint64_t value) {
+	Natural * natural = calloc(1, sizeof(Natural));
+	setNatural(natural, value);
+	return natural;
+}
+
+void destroyNatural(Natural * natural) {
+	if (natural != NULL) {
+		free(natural->limbs);
+		free(natural);
+	}
+}
+
+void setNatural(Natural * natural, const uint64_t value) {
+	_reserve(natural, 2);
+	natural->limbs[0] = (uint32_t) value;
+	natural->limbs[1] = (uint32_t) (value >> 32);
+	natural->count = 2;
+	_trim(natural);
+}
+
+void copyNatural(Natural * target, const Natural * source) {
+	if (target != source) {
+		_reserve(target, source->count);
+		memcpy(target->limbs, source->limbs, source->count * sizeof(uint32_t));
+		target->count = source->count;
+	}
+}
+
+void addNatural(Natural * sum, const Natural * addend) {
+	const unsigned int count = sum->count < addend->count ? addend->count : sum->count;
+	_reserve(sum, 1 + count);
+	uint64_t carry = 0;
+	for (unsigned int k = 0; k < count; ++k) {
+		carry += (k < sum->count ? sum->limbs[k] : 0) + (uint64_t) (k < addend->count ? addend->limbs[k] : 0);
+		sum->limbs[k] = (uint32_t) carry;
+		carry >>= 32;
+	}
+	sum->limbs[count] = (uint32_t) carry;
+	sum->count = 1 + count;
+	_trim(sum);
+}
+
+void multiplyNatural(Natural * product, const Natural * factor) {
+	if (product->count == 0 || factor->count == 0) {
+		product->count = 0;
+		return;
+	}
+	const unsigned int count = product->count + factor->count;
+	uint32_t * limbs = calloc(count, sizeof(uint32_t));
+	for (unsigned int i = 0; i < product->count; ++i) {
+		uint64_t carry = 0;
+		for (unsigned int j = 0; j < factor->count; ++j) {
+			carry += limbs[i + j] + (uint64_t) product->limbs[i] * factor->limbs[j];
+			limbs[i + j] = (uint32_t) carry;
+			carry >>= 32;
+		}
+		limbs[i + factor->count] = (uint32_t) carry;
+	}
+	free(product->limbs);
+	product->limbs = limbs;
+	product->count = count;
+	product->capacity = count;
+	_trim(product);
+}
+
+void shiftNatural(Natural * natural, const unsigned int bits) {
+	if (natural->count == 0 || bits == 0) {
+		return;
+	}
+	const unsigned int words = bits / 32;
+	const unsigned int offset = bits % 32;
+	_reserve(natural, natural->count + words + 1);
+	natural->limbs[natural->count + words] = 0;
+	for (unsigned int k = natural->count; 0 < k--;) {
+		const uint64_t limb = (uint64_t) natural->limbs[k] << offset;
+		natural->limbs[k + words + 1] |= (uint32_t) (limb >> 32);
+		natural->limbs[k + words] = (uint32_t) limb;
+	}
+	memset(natural->limbs, 0, words * sizeof(uint32_t));
+	natural->count += words + 1;
+	_trim(natural);
+}
+
+boolean isZeroNatural(const Natural * natural) {
+	return natural->count == 0;
+}
+
+char * naturalToString(const Natural * natural) {
+	// Every limb takes less than 10 decimal digits.
+	char * string = calloc(10 * natural->count + 2, sizeof(char));
+	if (natural->count == 0) {
+		string[0] = '0';
+		return string;
+	}
+	// The chunks of 9 digits, from the least significant one, obtained by
+	// dividing a copy by 10^9 until it's zero.
+	uint32_t * limbs = malloc(natural->count * sizeof(uint32_t));
+	memcpy(limbs, natural->limbs, natural->count * sizeof(uint32_t));
+	uint32_t * chunks = malloc((natural->count * 10 / 9 + 2) * sizeof(uint32_t));
+	unsigned int chunkCount = 0;
+	for (unsigned int count = natural->count; 0 < count;) {
+		uint64_t remainder = 0;
+		for (unsigned int k = count; 0 < k--;) {
+			remainder = (remainder << 32) | limbs[k];
+			limbs[k] = (uint32_t) (remainder / 1000000000u);
+			remainder %= 1000000000u;
+		}
+		chunks[chunkCount++] = (uint32_t) remainder;
+		while (0 < count && limbs[count - 1] == 0) {
+			--count;
+		}
+	}
+	char * cursor = string + sprintf(string, "%u", chunks[chunkCount - 1]);
+	for (unsigned int k = chunkCount - 1; 0 < k--;) {
+		cursor += sprintf(cursor, "%09u", chunks[k]);
+	}
+	free(chunks);
+	free(limbs);
+	return string;
+}
@@ -0,0 +1,64 @@
+#ifndef NATURAL_HEADER
+#define NATURAL_HEADER
+
+#include "Type.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * A natural number of arbitrary precision (e.g., an amount of models, which
+ * overflows 64 bits as soon as a formula has 64 variables). The limbs are
+ * kept from the least significant one, without leading zeros, so the zero
+ * has no limbs at all.
+ */
+typedef struct {
+	uint32_t * limbs;
+	unsigned int count;
+	unsigned int capacity;
+} Natural;
+
+/**
+ * Creates a natural number with the specified value.
+ */
+Natural * createNatural(const uint64_t value);
+
+/**
+ * Destroy a natural number.
+ */
+void destroyNatural(Natural * natural);
+
+/**
+ * Replaces the value of a natural number, with a small value or with the
+ * value of another one.
+ */
+void setNatural(Natural * natural, const uint64_t value);
+void copyNatural(Natural * target, const Natural * source);
+
+/**
+ * Adds a natural number to another one, in place.
+ */
+void addNatural(Natural * sum, const Natural * addend);
+
+/**
+ * Multiplies a natural number by another one, in place.
+ */
+void multiplyNatural(Natural * product, const Natural * factor);
+
+/**
+ * Multiplies a natural number by 2 to the specified power, in place.
+ */
+void shiftNatural(Natural * natural, const unsigned int bits);
+
+/**
+ * Returns true if a natural number is zero.
+ */
+boolean isZeroNatural(const Natural * natural);
+
+/**
+ * The decimal representation of a natural number (using heap-memory).
+ */
+char * naturalToString(const Natural * natural);
+
+#endif
@@ -0,0 +1,122 @@
+#include "SymbolTable.h"
+
+#define INITIAL_NAMESPACE_CAPACITY 64
+
+/**
+ * An open-addressing hash table (with linear probing), keyed by the dense ID
+ * of the interned names, so hashing and comparing a key is O(1).
+ */
+typedef struct {
+	Symbol ** slots;
+	unsigned int capacity;
+	unsigned int count;
+} Namespace;
+
+struct SymbolTable {
+	// Where the symbols are stored, so they never move.
+	Arena * arena;
+	Namespace namespaces[SYMBOL_KINDS];
+};
+
+/* PRIVATE FUNCTIONS */
+
+static unsigned int _findSlot(Symbol ** slots, const unsigned int capacity, const Identifier * name);
+static void _growNamespace(Namespace * namespace);
+static uint32_t _hash(const Identifier * name);
+
+/**
+ * Finds the slot of a name: the one that holds it, or the empty slot where it
+ * should be inserted.
+ */
+static unsigned int _findSlot(Symbol ** slots, const unsigned int capacity, const Identifier * name) {
+	const unsigned int mask = capacity - 1;
+	unsigned int slot = _hash(name) & mask;
+	while (slots[slot] != NULL && slots[slot]->name != name) {
+		slot = (slot + 1) & mask;
+	}
+	return slot;
+}
+
+/**
+ * Doubles the capacity of a namespace, and re-hashes its symbols.
+ */
+static void _growNamespace(Namespace * namespace) {
+	const unsigned int capacity = namespace->capacity == 0 ? INITIAL_NAMESPACE_CAPACITY : 2 * namespace->capacity;
+	Symbol ** slots = calloc(capacity, sizeof(Symbol *));
+	for (unsigned int k = 0; k < namespace->capacity; ++k) {
+		if (namespace->slots[k] != NULL) {
+			slots[_findSlot(slots, capacity, namespace->slots[k]->name)] = namespace->slots[k];
+		}
+	}
+	free(namespace->slots);
+	namespace->slots = slots;
+	namespace->capacity = capacity;
+}
+
+/**
+ * Fibonacci hashing over the dense ID of the name.
+ *
+ * @see https://en.wikipedia.org/wiki/Hash_function#Fibonacci_hashing
+ */
+static uint32_t _hash(const Identifier * name) {
+	return (name->id * 2654435769u) >> 8;
+}
+
+/* PUBLIC FUNCTIONS */
+
+SymbolTable * createSymbolTable() {
+	SymbolTable * symbolTable = calloc(1, sizeof(SymbolTable));
+	symbolTable->arena = createArena(DEFAULT_ARENA_BLOCK_SIZE);
+	return symbolTable;
+}
+
+void destroySymbolTable(SymbolTable * symbolTable) {
+	if (symbolTable != NULL) {
+		for (unsigned int kind = 0; kind < SYMBOL_KINDS; ++kind) {
+			free(symbolTable->namespaces[kind].slots);
+		}
+		destroyArena(symbolTable->arena);
+		free(symbolTable);
+	}
+}
+
+const Symbol * insertSymbol(SymbolTable * symbolTable, const SymbolKind kind, const Identifier * name, void * definition) {
+	Namespace * namespace = &symbolTable->namespaces[kind];
+	// Keeps the load factor under 1/2.
+	if (namespace->capacity <= 2 * namespace->count) {
+		_growNamespace(namespace);
+	}
+	const unsigned int slot = _findSlot(namespace->slots, namespace->capacity, name);
+	if (namespace->slots[slot] != NULL) {
+		return NULL;
+	}
+	Symbol * symbol = allocateInArena(symbolTable->arena, 1, sizeof(Symbol));
+	symbol->name = name;
+	symbol->definition = definition;
+	symbol->ordinal = namespace->count++;
+	namespace->slots[slot] = symbol;
+	return symbol;
+}
+
+const Symbol * lookupSymbol(const SymbolTable * symbolTable, const SymbolKind kind, const Identifier * name) {
+	const Namespace * namespace = &symbolTable->namespaces[kind];
+	if (namespace->count == 0) {
+		return NULL;
+	}
+	return namespace->slots[_findSlot(namespace->slots, namespace->capacity, name)];
+}
+
+unsigned int symbolCount(const SymbolTable * symbolTable, const SymbolKind kind) {
+	return symbolTable->namespaces[kind].count;
+}
+
+const char * symbolKindName(const SymbolKind kind) {
+	switch (kind) {
+		case VARIABLE_SYMBOL: return "variable";
+		case FORMULA_SYMBOL: return "formula";
+		case VALUATION_SYMBOL: return "valuation";
+		case OPERATOR_SYMBOL: return "operator";
+		case OPSET_SYMBOL: return "opset";
+		default: return "symbol";
+	}
+}
@@ -0,0 +1,72 @@
+#ifndef SYMBOL_TABLE_HEADER
+#define SYMBOL_TABLE_HEADER
+
+#include "Arena.h"
+#include "Identifier.h"
+#include "Type.h"
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * The kinds of symbols. Every kind has its own namespace, so a formula and a
+ * valuation can share the same name.
+ */
+typedef enum {
+	VARIABLE_SYMBOL = 0,
+	FORMULA_SYMBOL,
+	VALUATION_SYMBOL,
+	OPERATOR_SYMBOL,
+	OPSET_SYMBOL,
+	SYMBOL_KINDS
+} SymbolKind;
+
+/**
+ * An entry of the symbol table.
+ */
+typedef struct {
+	// The name of the symbol (interned).
+	const Identifier * name;
+
+	// The node that defines the symbol (its type depends on the kind).
+	void * definition;
+
+	// The order of definition inside its namespace, starting at 0.
+	unsigned int ordinal;
+} Symbol;
+
+typedef struct SymbolTable SymbolTable;
+
+/**
+ * Creates a new empty symbol table.
+ */
+SymbolTable * createSymbolTable();
+
+/**
+ * Destroy a symbol table. The definitions are not owned by the table, so
+ * they are not released.
+ */
+void destroySymbolTable(SymbolTable * symbolTable);
+
+/**
+ * Defines a new symbol. Returns NULL if the name was already defined in the
+ * namespace of that kind (in which case, the table is not modified). The
+ * returned symbol is stable: it lives as long as the table.
+ */
+const Symbol * insertSymbol(SymbolTable * symbolTable, const SymbolKind kind, const Identifier * name, void * definition);
+
+/**
+ * Finds a symbol by kind and name in O(1), or returns NULL if it's undefined.
+ */
+const Symbol * lookupSymbol(const SymbolTable * symbolTable, const SymbolKind kind, const Identifier * name);
+
+/**
+ * The amount of symbols defined in the namespace of a kind.
+ */
+unsigned int symbolCount(const SymbolTable * symbolTable, const SymbolKind kind);
+
+/**
+ * The name of a kind, for diagnostics (e.g., "formula").
+ */
+const char * symbolKindName(const SymbolKind kind);
+
+#endif
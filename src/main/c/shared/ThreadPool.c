@@ -0,0 +1,213 @@
+#include "ThreadPool.h"
+
+/**
+ * The chunks in [next, end) not yet claimed by a worker. The owner takes them
+ * from the bottom, and thieves take them from the top.
+ */
+typedef struct {
+	pthread_mutex_t mutex;
+	uint64_t next;
+	uint64_t end;
+} WorkerRange;
+
+typedef struct {
+	ThreadPool * threadPool;
+	unsigned int worker;
+} WorkerArguments;
+
+struct ThreadPool {
+	unsigned int threadCount;
+	pthread_t * threads;
+	WorkerArguments * arguments;
+	WorkerRange * ranges;
+
+	// Synchronizes the beginning and the end of every job.
+	pthread_mutex_t mutex;
+	pthread_cond_t jobStarted;
+	pthread_cond_t jobFinished;
+	uint64_t generation;
+	unsigned int busyWorkers;
+	boolean shutdown;
+
+	// The current job.
+	ChunkTask task;
+	void * context;
+	int cancelled;
+};
+
+/* PRIVATE FUNCTIONS */
+
+static boolean _claimChunk(ThreadPool * threadPool, const unsigned int worker, uint64_t * chunk);
+static boolean _stealChunks(ThreadPool * threadPool, const unsigned int worker);
+static void _work(ThreadPool * threadPool, const unsigned int worker);
+static void * _workerThread(void * arguments);
+
+/**
+ * Claims the next chunk of the range of a worker.
+ */
+static boolean _claimChunk(ThreadPool * threadPool, const unsigned int worker, uint64_t * chunk) {
+	WorkerRange * range = &threadPool->ranges[worker];
+	pthread_mutex_lock(&range->mutex);
+	const boolean claimed = range->next < range->end;
+	if (claimed) {
+		*chunk = range->next++;
+	}
+	pthread_mutex_unlock(&range->mutex);
+	return claimed;
+}
+
+/**
+ * Moves the upper half of the remaining chunks of another worker (the first
+ * one with work, after this one) to the range of this worker. Returns false
+ * if every range is empty.
+ */
+static boolean _stealChunks(ThreadPool * threadPool, const unsigned int worker) {
+	for (unsigned int k = 1; k < threadPool->threadCount; ++k) {
+		WorkerRange * victim = &threadPool->ranges[(worker + k) % threadPool->threadCount];
+		pthread_mutex_lock(&victim->mutex);
+		const uint64_t remaining = victim->end - victim->next;
+		if (0 < remaining) {
+			// The stolen chunks are moved without holding both locks at
+			// once, so concurrent thieves can never deadlock.
+			const uint64_t end = victim->end;
+			const uint64_t middle = end - (remaining + 1) / 2;
+			victim->end = middle;
+			pthread_mutex_unlock(&victim->mutex);
+			WorkerRange * range = &threadPool->ranges[worker];
+			pthread_mutex_lock(&range->mutex);
+			range->next = middle;
+			range->end = end;
+			pthread_mutex_unlock(&range->mutex);
+			return true;
+		}
+		pthread_mutex_unlock(&victim->mutex);
+	}
+	return false;
+}
+
+/**
+ * Runs the chunks of a worker, and then the ones it can steal.
+ */
+static void _work(ThreadPool * threadPool, const unsigned int worker) {
+	uint64_t chunk = 0;
+	while (!areChunksCancelled(threadPool)) {
+		if (_claimChunk(threadPool, worker, &chunk)) {
+			threadPool->task(chunk, worker, threadPool->context);
+		}
+		else if (!_stealChunks(threadPool, worker)) {
+			break;
+		}
+	}
+}
+
+/**
+ * The loop of every spawned thread: waits for a job, works on it, and
+ * reports that it's done.
+ */
+static void * _workerThread(void * arguments) {
+	ThreadPool * threadPool = ((WorkerArguments *) arguments)->threadPool;
+	const unsigned int worker = ((WorkerArguments *) arguments)->worker;
+	uint64_t generation = 0;
+	pthread_mutex_lock(&threadPool->mutex);
+	while (true) {
+		while (!threadPool->shutdown && threadPool->generation == generation) {
+			pthread_cond_wait(&threadPool->jobStarted, &threadPool->mutex);
+		}
+		if (threadPool->shutdown) {
+			break;
+		}
+		generation = threadPool->generation;
+		pthread_mutex_unlock(&threadPool->mutex);
+		_work(threadPool, worker);
+		pthread_mutex_lock(&threadPool->mutex);
+		if (--threadPool->busyWorkers == 0) {
+			pthread_cond_signal(&threadPool->jobFinished);
+		}
+	}
+	pthread_mutex_unlock(&threadPool->mutex);
+	return NULL;
+}
+
+/* PUBLIC FUNCTIONS */
+
+ThreadPool * createThreadPool(const unsigned int threadCount) {
+	ThreadPool * threadPool = calloc(1, sizeof(ThreadPool));
+	threadPool->threadCount = threadCount == 0 ? 1 : threadCount;
+	threadPool->threads = calloc(threadPool->threadCount, sizeof(pthread_t));
+	threadPool->arguments = calloc(threadPool->threadCount, sizeof(WorkerArguments));
+	threadPool->ranges = calloc(threadPool->threadCount, sizeof(WorkerRange));
+	pthread_mutex_init(&threadPool->mutex, NULL);
+	pthread_cond_init(&threadPool->jobStarted, NULL);
+	pthread_cond_init(&threadPool->jobFinished, NULL);
+	for (unsigned int k = 0; k < threadPool->threadCount; ++k) {
+		pthread_mutex_init(&threadPool->ranges[k].mutex, NULL);
+		threadPool->arguments[k].threadPool = threadPool;
+		threadPool->arguments[k].worker = k;
+	}
+	// The worker 0 is the caller of "runChunks".
+	for (unsigned int k = 1; k < threadPool->threadCount; ++k) {
+		pthread_create(&threadPool->threads[k], NULL, _workerThread, &threadPool->arguments[k]);
+	}
+	return threadPool;
+}
+
+void destroyThreadPool(ThreadPool * threadPool) {
+	if (threadPool == NULL) {
+		return;
+	}
+	pthread_mutex_lock(&threadPool->mutex);
+	threadPool->shutdown = true;
+	pthread_cond_broadcast(&threadPool->jobStarted);
+	pthread_mutex_unlock(&threadPool->mutex);
+	for (unsigned int k = 1; k < threadPool->threadCount; ++k) {
+		pthread_join(threadPool->threads[k], NULL);
+	}
+	for (unsigned int k = 0; k < threadPool->threadCount; ++k) {
+		pthread_mutex_destroy(&threadPool->ranges[k].mutex);
+	}
+	pthread_cond_destroy(&threadPool->jobFinished);
+	pthread_cond_destroy(&threadPool->jobStarted);
+	pthread_mutex_destroy(&threadPool->mutex);
+	free(threadPool->ranges);
+	free(threadPool->arguments);
+	free(threadPool->threads);
+	free(threadPool);
+}
+
+unsigned int threadPoolSize(const ThreadPool * threadPool) {
+	return threadPool->threadCount;
+}
+
+void runChunks(ThreadPool * threadPool, const uint64_t chunkCount, ChunkTask task, void * context) {
+	const unsigned int threadCount = threadPool->threadCount;
+	threadPool->task = task;
+	threadPool->context = context;
+	__atomic_store_n(&threadPool->cancelled, 0, __ATOMIC_RELAXED);
+	for (unsigned int k = 0; k < threadCount; ++k) {
+		threadPool->ranges[k].next = chunkCount * k / threadCount;
+		threadPool->ranges[k].end = chunkCount * (k + 1) / threadCount;
+	}
+	if (threadCount == 1 || chunkCount == 1) {
+		_work(threadPool, 0);
+		return;
+	}
+	pthread_mutex_lock(&threadPool->mutex);
+	threadPool->busyWorkers = threadCount - 1;
+	++threadPool->generation;
+	pthread_cond_broadcast(&threadPool->jobStarted);
+	pthread_mutex_unlock(&threadPool->mutex);
+	_work(threadPool, 0);
+	pthread_mutex_lock(&threadPool->mutex);
+	while (0 < threadPool->busyWorkers) {
+		pthread_cond_wait(&threadPool->jobFinished, &threadPool->mutex);
+	}
+	pthread_mutex_unlock(&threadPool->mutex);
+}
+
+void cancelChunks(ThreadPool * threadPool) {
+	__atomic_store_n(&threadPool->cancelled, 1, __ATOMIC_RELAXED);
+}
+
+boolean areChunksCancelled(ThreadPool * threadPool) {
+	return __atomic_load_n(&threadPool->cancelled, __ATOMIC_RELAXED) != 0;
+}
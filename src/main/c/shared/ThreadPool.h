@@ -0,0 +1,53 @@
+#ifndef THREAD_POOL_HEADER
+#define THREAD_POOL_HEADER
+
+#include "Type.h"
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * A task over a single chunk of a job. The worker is a number in the range
+ * [0, threadCount), so tasks can keep per-worker scratch memory without
+ * locking.
+ */
+typedef void (*ChunkTask)(const uint64_t chunk, const unsigned int worker, void * context);
+
+typedef struct ThreadPool ThreadPool;
+
+/**
+ * Creates a pool of the specified amount of threads, including the thread
+ * that runs the jobs (so a pool of 1 thread never spawns anything).
+ */
+ThreadPool * createThreadPool(const unsigned int threadCount);
+
+/**
+ * Joins the threads of the pool, and releases its resources.
+ */
+void destroyThreadPool(ThreadPool * threadPool);
+
+/**
+ * The amount of threads of the pool, including the caller.
+ */
+unsigned int threadPoolSize(const ThreadPool * threadPool);
+
+/**
+ * Runs a task over every chunk in [0, chunkCount), and returns when all of
+ * them are done (or the job was cancelled). The chunks are split evenly
+ * among the workers, and an idle worker steals the upper half of the
+ * remaining chunks of another one. The calling thread works as the worker 0.
+ */
+void runChunks(ThreadPool * threadPool, const uint64_t chunkCount, ChunkTask task, void * context);
+
+/**
+ * Cancels the current job: every worker stops before starting its next
+ * chunk. Meant to be called from inside a task.
+ */
+void cancelChunks(ThreadPool * threadPool);
+
+/**
+ * Returns true if the current job was cancelled.
+ */
+boolean areChunksCancelled(ThreadPool * threadPool);
+
+#endif